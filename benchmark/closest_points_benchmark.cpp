@@ -0,0 +1,77 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+#include "support/soa_columns.hpp"
+
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+using ::rigid_geometric_algebra::closest_points;
+using ::rigid_geometric_algebra::soa_span;
+using ::support::columns;
+
+constexpr auto count = 1UZ << 20U;
+
+// lines through pairs of random points
+auto random_lines(std::mt19937& rng) -> std::vector<G3::line>
+{
+  auto dist = std::uniform_real_distribution{-1.0, 1.0};
+
+  const auto point = [&] {
+    return G3::point{1.0, dist(rng), dist(rng), dist(rng)};
+  };
+
+  auto lines = std::vector<G3::line>{};
+  lines.reserve(count);
+  for (auto i = 0UZ; i != count; ++i) {
+    lines.push_back(point() ^ point());
+  }
+  return lines;
+}
+
+}  // namespace
+
+// closest points between pairs of lines, computed per pair from arrays of
+// lines and in a batch from line coefficient arrays
+auto main() -> int
+{
+  auto rng = std::mt19937{0};
+  const auto ks = random_lines(rng);
+  const auto ls = random_lines(rng);
+
+  auto results = std::vector<std::pair<G3::point, G3::point>>(count);
+
+  benchmark::run("closest_points(k, l)", count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      results[i] = closest_points(ks[i], ls[i]);
+    }
+    benchmark::do_not_optimize(results);
+  });
+
+  auto k_columns = columns<G3::line>(count);
+  auto l_columns = columns<G3::line>(count);
+  auto p_columns = columns<G3::point>(count);
+  auto q_columns = columns<G3::point>(count);
+
+  for (auto i = 0UZ; i != count; ++i) {
+    soa_span<G3::line>{k_columns}.store(i, ks[i]);
+    soa_span<G3::line>{l_columns}.store(i, ls[i]);
+  }
+
+  const auto k_span = soa_span<const G3::line>{k_columns};
+  const auto l_span = soa_span<const G3::line>{l_columns};
+  const auto ps = soa_span<G3::point>{p_columns};
+  const auto qs = soa_span<G3::point>{q_columns};
+
+  benchmark::run("closest_points(ks, ls, ps, qs)", count, [&] {
+    closest_points(k_span, l_span, ps, qs);
+    benchmark::do_not_optimize(p_columns);
+    benchmark::do_not_optimize(q_columns);
+  });
+}
@@ -0,0 +1,119 @@
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+using ::rigid_geometric_algebra::soa_span;
+using ::rigid_geometric_algebra::detail::contract_violation_handler;
+using ::rigid_geometric_algebra::detail::precondition;
+
+constexpr auto count = 4096UZ;
+
+auto rng = std::mt19937{0};
+auto dist = std::uniform_real_distribution{-1.0, 1.0};
+
+auto make_points() -> std::vector<G3::point>
+{
+  auto points = std::vector<G3::point>(count);
+  for (auto& p : points) {
+    p = G3::point{dist(rng), dist(rng), dist(rng), dist(rng)};
+  }
+  return points;
+}
+
+}  // namespace
+
+// cost of checking preconditions in element access on the hot path. The
+// condition is always satisfied, so the checked loops should only differ from
+// the unchecked loops by a compare and a predicted branch per access.
+auto main() -> int
+{
+  const auto points = make_points();
+  const auto values = [&points] {
+    auto v = std::vector<double>{};
+    for (const auto& p : points) {
+      v.insert(v.end(), p.begin(), p.end());
+    }
+    return v;
+  }();
+
+  benchmark::run("values[i] (unchecked)", values.size(), [&values] {
+    auto sum = 0.;
+    for (auto i = 0UZ; i != values.size(); ++i) {
+      sum += values[i];
+    }
+    benchmark::do_not_optimize(sum);
+  });
+
+  benchmark::run("values[i] (eager handler)", values.size(), [&values] {
+    auto sum = 0.;
+    for (auto i = 0UZ; i != values.size(); ++i) {
+      const auto n = values.size();
+      precondition(
+          i < n,
+          contract_violation_handler{
+              "index value '{}' not less than size '{}'", i, n});
+      sum += values[i];
+    }
+    benchmark::do_not_optimize(sum);
+  });
+
+  benchmark::run("values[i] (lazy handler)", values.size(), [&values] {
+    auto sum = 0.;
+    for (auto i = 0UZ; i != values.size(); ++i) {
+      precondition(i < values.size(), [i, n = values.size()] {
+        return contract_violation_handler{
+            "index value '{}' not less than size '{}'", i, n};
+      });
+      sum += values[i];
+    }
+    benchmark::do_not_optimize(sum);
+  });
+
+  benchmark::run("get<I>(point) (unchecked)", count, [&points] {
+    auto sum = 0.;
+    for (const auto& p : points) {
+      sum += [&v = p.multivector()]<std::size_t... Is>(
+                 std::index_sequence<Is...>) {
+        return (v.template get<Is>().coefficient + ...);
+      }(std::make_index_sequence<G3::point::size>{});
+    }
+    benchmark::do_not_optimize(sum);
+  });
+
+  benchmark::run("point[i] (checked)", count, [&points] {
+    auto sum = 0.;
+    for (const auto& p : points) {
+      for (auto i = 0UZ; i != G3::point::size; ++i) {
+        sum += p[i];
+      }
+    }
+    benchmark::do_not_optimize(sum);
+  });
+
+  auto columns = std::array<std::vector<double>, G3::point::size>{};
+  for (auto j = 0UZ; j != columns.size(); ++j) {
+    for (const auto& p : points) {
+      columns[j].push_back(p[j]);
+    }
+  }
+  const auto soa = soa_span<const G3::point>{columns};
+
+  benchmark::run("soa_span[i] (checked)", count, [soa] {
+    auto sum = 0.;
+    for (auto i = 0UZ; i != soa.size(); ++i) {
+      sum += soa[i].multivector().template get<0>().coefficient;
+    }
+    benchmark::do_not_optimize(sum);
+  });
+}
@@ -0,0 +1,83 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <random>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+using ::rigid_geometric_algebra::convex_hull;
+using ::rigid_geometric_algebra::convex_hull_workspace;
+using ::rigid_geometric_algebra::halfspace_intersection;
+
+// points uniformly distributed in the unit ball
+auto ball_points(std::size_t n) -> std::vector<G3::point>
+{
+  auto rng = std::mt19937{0};
+  auto dist = std::uniform_real_distribution{-1.0, 1.0};
+
+  auto points = std::vector<G3::point>{};
+  points.reserve(n);
+  while (points.size() != n) {
+    const auto x = dist(rng);
+    const auto y = dist(rng);
+    const auto z = dist(rng);
+    if (x * x + y * y + z * z <= 1.0) {
+      points.push_back(G3::point{1.0, x, y, z});
+    }
+  }
+  return points;
+}
+
+// planes tangent to the unit sphere at random points, facing outward
+auto tangent_planes(std::size_t n) -> std::vector<G3::plane>
+{
+  auto rng = std::mt19937{1};
+  auto dist = std::normal_distribution{};
+
+  auto planes = std::vector<G3::plane>{};
+  planes.reserve(n);
+  while (planes.size() != n) {
+    const auto x = dist(rng);
+    const auto y = dist(rng);
+    const auto z = dist(rng);
+    const auto r = std::sqrt(x * x + y * y + z * z);
+    if (r > 0.0) {
+      planes.push_back(G3::plane{x / r, y / r, z / r, -1.0});
+    }
+  }
+  return planes;
+}
+
+}  // namespace
+
+// convex hull of points in a ball and intersection of half-spaces tangent
+// to a sphere, reusing a workspace between iterations
+auto main() -> int
+{
+  for (const auto count : {100'000UZ, 1'000'000UZ}) {
+    const auto points = ball_points(count);
+    auto workspace = convex_hull_workspace<G3>{count};
+
+    benchmark::run(std::format("convex_hull ({} points)", count), count, [&] {
+      benchmark::do_not_optimize(convex_hull(points, workspace));
+    });
+  }
+
+  for (const auto count : {100'000UZ, 1'000'000UZ}) {
+    const auto planes = tangent_planes(count);
+    auto workspace = convex_hull_workspace<G3>{count};
+
+    benchmark::run(
+        std::format("halfspace_intersection ({} planes)", count), count, [&] {
+          benchmark::do_not_optimize(halfspace_intersection(
+              planes, G3::point{1.0, 0.0, 0.0, 0.0}, workspace));
+        });
+  }
+}
@@ -0,0 +1,107 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+#include "support/soa_columns.hpp"
+
+#include <cstddef>
+#include <format>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using magnitude = ::rigid_geometric_algebra::homogeneous_magnitude_t<G3>;
+
+using ::rigid_geometric_algebra::soa_span;
+using ::support::columns;
+
+constexpr auto count = 4096UZ;
+
+auto rng = std::mt19937{0};
+auto dist = std::uniform_real_distribution{-1.0, 1.0};
+auto positive = std::uniform_real_distribution{0.5, 2.0};
+
+template <class T>
+auto make_random() -> T;
+
+template <>
+auto make_random<G3::point>() -> G3::point
+{
+  return {positive(rng), dist(rng), dist(rng), dist(rng)};
+}
+
+template <>
+auto make_random<G3::line>() -> G3::line
+{
+  // direction and moment are exactly perpendicular
+  return {dist(rng), dist(rng), 0, 0, 0, dist(rng)};
+}
+
+template <>
+auto make_random<G3::plane>() -> G3::plane
+{
+  return {dist(rng), dist(rng), dist(rng), dist(rng)};
+}
+
+template <class T>
+class batch
+{
+  std::vector<T> values_{};
+  decltype(columns<T>(0)) columns_{columns<T>(count)};
+
+public:
+  batch() : values_(count)
+  {
+    const auto s = soa_span<T>{columns_};
+    for (auto i = 0UZ; i != count; ++i) {
+      values_[i] = make_random<T>();
+      s.store(i, values_[i]);
+    }
+  }
+
+  auto values() const -> const std::vector<T>& { return values_; }
+  auto span() -> soa_span<const T> { return soa_span<T>{columns_}; }
+};
+
+template <class T1, class T2, class F>
+auto run_pair(std::string_view name, F f) -> void
+{
+  auto as = batch<T1>{};
+  auto bs = batch<T2>{};
+
+  auto out = std::vector<magnitude>(count);
+  auto out_columns = columns<magnitude>(count);
+  const auto os = soa_span<magnitude>{out_columns};
+
+  benchmark::run(name, count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      out[i] = f(as.values()[i], bs.values()[i]);
+    }
+    benchmark::do_not_optimize(out);
+  });
+
+  benchmark::run(std::format("{} (soa)", name), count, [&] {
+    f(as.span(), bs.span(), os);
+    benchmark::do_not_optimize(out_columns);
+  });
+}
+
+}  // namespace
+
+auto main() -> int
+{
+  using ::rigid_geometric_algebra::angle;
+  using ::rigid_geometric_algebra::distance;
+
+  run_pair<G3::point, G3::point>("distance point-point", distance);
+  run_pair<G3::point, G3::line>("distance point-line", distance);
+  run_pair<G3::point, G3::plane>("distance point-plane", distance);
+  run_pair<G3::line, G3::line>("distance line-line", distance);
+  run_pair<G3::plane, G3::plane>("distance plane-plane", distance);
+
+  run_pair<G3::line, G3::line>("angle line-line", angle);
+  run_pair<G3::plane, G3::plane>("angle plane-plane", angle);
+  run_pair<G3::line, G3::plane>("angle line-plane", angle);
+}
@@ -0,0 +1,87 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+using ::rigid_geometric_algebra::antiwedge;
+using ::rigid_geometric_algebra::geometric_antiproduct;
+using ::rigid_geometric_algebra::wedge;
+
+using dynamic = ::rigid_geometric_algebra::dynamic_multivector<double>;
+
+using point = G3::point::multivector_type;
+using plane = G3::plane::multivector_type;
+using motor = G3::motor::multivector_type;
+
+constexpr auto count = 4096UZ;
+
+auto rng = std::mt19937{0};
+auto dist = std::uniform_real_distribution{-1.0, 1.0};
+
+template <class V>
+auto make_random() -> std::vector<V>
+{
+  auto values = std::vector<V>(count);
+  for (auto& v : values) {
+    [&v]<std::size_t... Is>(std::index_sequence<Is...>) {
+      ((v.template get<Is>().coefficient = dist(rng)), ...);
+    }(std::make_index_sequence<V::size>{});
+  }
+  return values;
+}
+
+template <class V>
+auto make_dynamic(const std::vector<V>& values) -> std::vector<dynamic>
+{
+  auto out = std::vector<dynamic>{};
+  out.reserve(values.size());
+  for (const auto& v : values) {
+    out.emplace_back(v);
+  }
+  return out;
+}
+
+template <class F>
+auto run_op(std::string_view name, const auto& x, const auto& y, F f) -> void
+{
+  auto out = std::vector<decltype(f(x[0], y[0]))>(count, f(x[0], y[0]));
+
+  benchmark::run(name, count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      out[i] = f(x[i], y[i]);
+    }
+    benchmark::do_not_optimize(out);
+  });
+}
+
+template <class V, class F>
+auto compare(std::string_view name, F f) -> void
+{
+  const auto x = make_random<V>();
+  const auto y = make_random<V>();
+
+  run_op(std::string{name} + " (multivector)", x, y, f);
+  run_op(std::string{name} + " (dynamic)", make_dynamic(x), make_dynamic(y), f);
+}
+
+}  // namespace
+
+// products of `dynamic_multivector`, evaluated with runtime Cayley tables,
+// compared to the same products of `multivector`, where blades and signs are
+// resolved at compile time
+auto main() -> int
+{
+  compare<point>("wedge(point, point)", wedge);
+  compare<plane>("antiwedge(plane, plane)", antiwedge);
+  compare<motor>("geometric_antiproduct(motor, motor)", geometric_antiproduct);
+}
@@ -0,0 +1,111 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+#include "support/soa_columns.hpp"
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using bivector = G3::line::multivector_type;
+
+using ::rigid_geometric_algebra::soa_span;
+using ::support::columns;
+
+constexpr auto count = 4096UZ;
+
+// power series of the geometric antiproduct, truncated after `N` terms
+template <int N>
+auto exp_series(const bivector& l) -> G3::motor
+{
+  using ::rigid_geometric_algebra::geometric_antiproduct;
+  using ::rigid_geometric_algebra::to_multivector;
+  using M = G3::motor::multivector_type;
+
+  auto term = M{to_multivector(G3::unit_hypervolume)};
+  auto sum = term;
+
+  for (auto k = 1; k != N; ++k) {
+    term = (1. / k) * M{geometric_antiproduct(term, l)};
+    sum = sum + term;
+  }
+
+  return G3::motor{sum};
+}
+
+}  // namespace
+
+auto main() -> int
+{
+  using ::rigid_geometric_algebra::exp;
+  using ::rigid_geometric_algebra::log;
+
+  auto rng = std::mt19937{0};
+  auto dist = std::uniform_real_distribution{-1.0, 1.0};
+
+  auto lines = std::vector<bivector>(count);
+  for (auto& l : lines) {
+    l = bivector{
+        dist(rng), dist(rng), dist(rng), dist(rng), dist(rng), dist(rng)};
+  }
+
+  auto motors = std::vector<G3::motor>(count);
+  auto logs = std::vector<bivector>(count);
+
+  auto line_columns = columns<bivector>(count);
+  auto motor_columns = columns<G3::motor>(count);
+  auto log_columns = columns<bivector>(count);
+
+  const auto ls = soa_span<bivector>{line_columns};
+  const auto qs = soa_span<G3::motor>{motor_columns};
+  const auto bs = soa_span<bivector>{log_columns};
+
+  for (auto i = 0UZ; i != count; ++i) {
+    ls.store(i, lines[i]);
+  }
+
+  benchmark::run("exp closed form", count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      motors[i] = exp(lines[i]);
+    }
+    benchmark::do_not_optimize(motors);
+  });
+
+  benchmark::run("exp closed form (soa)", count, [&] {
+    exp(soa_span<const bivector>{ls}, qs);
+    benchmark::do_not_optimize(motor_columns);
+  });
+
+  benchmark::run("exp series (8 terms)", count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      motors[i] = exp_series<8>(lines[i]);
+    }
+    benchmark::do_not_optimize(motors);
+  });
+
+  benchmark::run("exp series (16 terms)", count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      motors[i] = exp_series<16>(lines[i]);
+    }
+    benchmark::do_not_optimize(motors);
+  });
+
+  for (auto i = 0UZ; i != count; ++i) {
+    motors[i] = exp(lines[i]);
+  }
+
+  benchmark::run("log closed form", count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      logs[i] = log(motors[i]);
+    }
+    benchmark::do_not_optimize(logs);
+  });
+
+  benchmark::run("log closed form (soa)", count, [&] {
+    log(soa_span<const G3::motor>{qs}, bs);
+    benchmark::do_not_optimize(log_columns);
+  });
+}
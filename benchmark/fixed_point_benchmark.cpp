@@ -0,0 +1,106 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+
+#include <array>
+#include <cstddef>
+#include <format>
+#include <random>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using ::rigid_geometric_algebra::algebra;
+using ::rigid_geometric_algebra::antiwedge;
+using ::rigid_geometric_algebra::fixed_point;
+using ::rigid_geometric_algebra::overflow_policy;
+using ::rigid_geometric_algebra::wedge;
+
+constexpr auto count = 4096UZ;
+
+// random coefficients, shared by all field types
+template <std::size_t N>
+auto random_coefficients() -> std::vector<std::array<double, N>>
+{
+  static auto rng = std::mt19937{0};
+  auto dist = std::uniform_real_distribution{-1.0, 1.0};
+
+  auto values = std::vector<std::array<double, N>>(count);
+  for (auto& v : values) {
+    for (auto& c : v) {
+      c = dist(rng);
+    }
+  }
+  return values;
+}
+
+const auto point_coefficients = random_coefficients<4>();
+const auto line_coefficients = random_coefficients<6>();
+const auto plane_coefficients = random_coefficients<4>();
+
+template <class V, std::size_t N>
+auto convert(const std::vector<std::array<double, N>>& coefficients)
+    -> std::vector<V>
+{
+  using F = std::remove_cvref_t<decltype(V{}.template get<0>().coefficient)>;
+
+  auto values = std::vector<V>{};
+  values.reserve(coefficients.size());
+  for (const auto& c : coefficients) {
+    values.push_back([&c]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return V{F(c[Is])...};
+    }(std::make_index_sequence<N>{}));
+  }
+  return values;
+}
+
+template <class F>
+auto run_op(std::string_view name, const auto& x, const auto& y, F f) -> void
+{
+  auto out = std::vector<decltype(f(x[0], y[0]))>(count);
+
+  benchmark::run(name, count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      out[i] = f(x[i], y[i]);
+    }
+    benchmark::do_not_optimize(out);
+  });
+}
+
+template <class T>
+auto run_field(std::string_view field) -> void
+{
+  using A = algebra<T, 3>;
+
+  const auto points = convert<typename A::point::multivector_type>(
+      point_coefficients);
+  const auto lines =
+      convert<typename A::line::multivector_type>(line_coefficients);
+  const auto planes = convert<typename A::plane::multivector_type>(
+      plane_coefficients);
+
+  run_op(std::format("wedge point-point ({})", field), points, points, wedge);
+  run_op(std::format("wedge line-point ({})", field), lines, points, wedge);
+  run_op(
+      std::format("antiwedge plane-plane ({})", field),
+      planes,
+      planes,
+      antiwedge);
+  run_op(
+      std::format("antiwedge line-plane ({})", field),
+      lines,
+      planes,
+      antiwedge);
+}
+
+}  // namespace
+
+auto main() -> int
+{
+  run_field<double>("double");
+  run_field<fixed_point<32>>("Q31.32, saturate");
+  run_field<fixed_point<32, overflow_policy::wrap>>("Q31.32, wrap");
+}
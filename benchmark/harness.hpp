@@ -0,0 +1,64 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <string_view>
+
+/// minimal timing harness for benchmarks
+///
+/// Benchmarks are built as binaries and are intended to be run with
+/// optimizations enabled:
+/// ```
+/// bazel run -c opt //benchmark:<name>
+/// ```
+///
+namespace benchmark {
+
+/// prevents the compiler from optimizing away the computation of a value
+///
+template <class T>
+inline auto do_not_optimize(const T& value) -> void
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// measures the mean time per item of a function
+/// @param name benchmark name
+/// @param items number of items processed by each invocation of `f`
+/// @param f function to measure
+///
+/// Invokes `f` repeatedly for at least `min_duration` after a single warm-up
+/// invocation and prints the mean time and throughput per item.
+///
+template <class F>
+auto run(std::string_view name, std::size_t items, F&& f) -> void
+{
+  using clock = std::chrono::steady_clock;
+  static constexpr auto min_duration = std::chrono::milliseconds{250};
+
+  f();
+
+  auto iterations = 0UZ;
+  auto elapsed = clock::duration{};
+  const auto start = clock::now();
+
+  while (elapsed < min_duration) {
+    f();
+    ++iterations;
+    elapsed = clock::now() - start;
+  }
+
+  const auto ns_per_item =
+      std::chrono::duration<double, std::nano>{elapsed}.count() /
+      static_cast<double>(iterations * items);
+
+  std::cout << std::format(
+      "{:<48}{:>10.2f} ns/item{:>14.3e} items/s\n",
+      name,
+      ns_per_item,
+      1e9 / ns_per_item);
+}
+
+}  // namespace benchmark
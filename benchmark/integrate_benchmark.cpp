@@ -0,0 +1,84 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+#include "support/soa_columns.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <format>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using bivector = G3::line::multivector_type;
+using body_type = ::rigid_geometric_algebra::rigid_body<G3>;
+using inertia_type = ::rigid_geometric_algebra::rigid_body_inertia<G3>;
+
+using ::rigid_geometric_algebra::soa_span;
+using ::support::columns;
+
+constexpr auto count = 1UZ << 16U;
+constexpr auto dt = 1e-3;
+
+}  // namespace
+
+auto main() -> int
+{
+  using ::rigid_geometric_algebra::integrate;
+
+  auto rng = std::mt19937{0};
+  auto dist = std::uniform_real_distribution{-1.0, 1.0};
+  auto positive = std::uniform_real_distribution{0.5, 2.0};
+
+  auto bodies = std::vector<body_type>(count);
+  auto forques = std::vector<bivector>(count);
+  auto inertias = std::vector<inertia_type>(count);
+
+  for (auto i = 0UZ; i != count; ++i) {
+    bodies[i].velocity = bivector{
+        dist(rng), dist(rng), dist(rng), dist(rng), dist(rng), dist(rng)};
+    forques[i] = bivector{
+        dist(rng), dist(rng), dist(rng), dist(rng), dist(rng), dist(rng)};
+    inertias[i] = {
+        .mass = positive(rng),
+        .moment_x = positive(rng),
+        .moment_y = positive(rng),
+        .moment_z = positive(rng)};
+  }
+
+  auto pose_columns = columns<G3::motor>(count);
+  auto velocity_columns = columns<bivector>(count);
+  auto forque_columns = columns<bivector>(count);
+
+  const auto qs = soa_span<G3::motor>{pose_columns};
+  const auto bs = soa_span<bivector>{velocity_columns};
+  const auto fs = soa_span<bivector>{forque_columns};
+
+  for (auto i = 0UZ; i != count; ++i) {
+    qs.store(i, bodies[i].pose);
+    bs.store(i, bodies[i].velocity);
+    fs.store(i, forques[i]);
+  }
+
+  benchmark::run("integrate", count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      bodies[i] = integrate(bodies[i], forques[i], inertias[i], dt);
+    }
+    benchmark::do_not_optimize(bodies);
+  });
+
+  const auto max_threads =
+      std::max(1U, std::thread::hardware_concurrency());
+
+  for (auto threads = 1U; threads <= max_threads; threads *= 2U) {
+    benchmark::run(
+        std::format("integrate (soa, {} threads)", threads), count, [&] {
+          integrate(qs, bs, fs, inertias, dt, threads);
+          benchmark::do_not_optimize(pose_columns);
+          benchmark::do_not_optimize(velocity_columns);
+        });
+  }
+}
@@ -0,0 +1,99 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace {
+
+using ::rigid_geometric_algebra::algebra;
+using ::rigid_geometric_algebra::antiwedge;
+using ::rigid_geometric_algebra::dual_number;
+using ::rigid_geometric_algebra::exp;
+using ::rigid_geometric_algebra::get;
+using ::rigid_geometric_algebra::transform;
+
+using D6 = dual_number<double, 6>;
+
+constexpr auto count = 4096UZ;
+
+struct sample
+{
+  std::array<double, 6> b;
+  std::array<double, 4> p;
+  std::array<double, 4> g;
+};
+
+// signed distance of the point `p` moved by `exp(b)` from the plane `g`
+template <class F>
+auto residual(
+    const std::array<F, 6>& b,
+    const std::array<double, 4>& p,
+    const std::array<double, 4>& g) -> F
+{
+  using A = algebra<F, 3>;
+
+  const auto l = typename A::line::multivector_type{
+      b[0], b[1], b[2], b[3], b[4], b[5]};
+  const auto q = transform(
+      exp(l), typename A::point{F{p[0]}, F{p[1]}, F{p[2]}, F{p[3]}});
+  const auto h = typename A::plane{F{g[0]}, F{g[1]}, F{g[2]}, F{g[3]}};
+
+  return get<typename A::scalar>(antiwedge(h.multivector(), q.multivector()))
+      .coefficient;
+}
+
+}  // namespace
+
+auto main() -> int
+{
+  auto rng = std::mt19937{0};
+  auto dist = std::uniform_real_distribution{-1.0, 1.0};
+
+  auto samples = std::vector<sample>(count);
+  for (auto& s : samples) {
+    for (auto& c : s.b) {
+      c = dist(rng);
+    }
+    s.p = {1, dist(rng), dist(rng), dist(rng)};
+    s.g = {dist(rng), dist(rng), dist(rng), dist(rng)};
+  }
+
+  auto jacobians = std::vector<std::array<double, 6>>(count);
+
+  benchmark::run("residual jacobian, dual number", count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      const auto& s = samples[i];
+
+      auto b = std::array<D6, 6>{};
+      for (auto j = 0UZ; j != b.size(); ++j) {
+        b[j] = D6::variable(s.b[j], j);
+      }
+
+      jacobians[i] = residual(b, s.p, s.g).gradient;
+    }
+    benchmark::do_not_optimize(jacobians);
+  });
+
+  benchmark::run("residual jacobian, central difference", count, [&] {
+    static constexpr auto h = 1e-6;
+
+    for (auto i = 0UZ; i != count; ++i) {
+      const auto& s = samples[i];
+
+      for (auto j = 0UZ; j != s.b.size(); ++j) {
+        auto lo = s.b;
+        auto hi = s.b;
+        lo[j] -= h;
+        hi[j] += h;
+
+        jacobians[i][j] =
+            (residual(hi, s.p, s.g) - residual(lo, s.p, s.g)) / (2 * h);
+      }
+    }
+    benchmark::do_not_optimize(jacobians);
+  });
+}
@@ -0,0 +1,97 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+#include "support/soa_columns.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+using ::rigid_geometric_algebra::join_triangles;
+using ::rigid_geometric_algebra::soa_span;
+using ::rigid_geometric_algebra::wedge;
+using ::support::columns;
+
+// vertices per side of a square grid mesh
+constexpr auto side = 512UZ;
+
+// two triangles for each cell of the grid
+auto grid_indices() -> std::vector<std::uint32_t>
+{
+  auto indices = std::vector<std::uint32_t>{};
+  indices.reserve(6 * (side - 1) * (side - 1));
+
+  for (auto y = 0UZ; y != side - 1; ++y) {
+    for (auto x = 0UZ; x != side - 1; ++x) {
+      const auto i = static_cast<std::uint32_t>(y * side + x);
+      const auto s = static_cast<std::uint32_t>(side);
+      indices.insert(indices.end(), {i, i + 1, i + s, i + 1, i + s + 1, i + s});
+    }
+  }
+  return indices;
+}
+
+}  // namespace
+
+// planes of the triangles of an indexed grid mesh, computed per triangle
+// with `wedge` from an array of points and with `join_triangles` from
+// vertex coefficient arrays
+auto main() -> int
+{
+  auto rng = std::mt19937{0};
+  auto dist = std::uniform_real_distribution{-1.0, 1.0};
+
+  auto points = std::vector<G3::point>{};
+  points.reserve(side * side);
+  for (auto y = 0UZ; y != side; ++y) {
+    for (auto x = 0UZ; x != side; ++x) {
+      points.push_back(G3::point{
+          1.0, static_cast<double>(x), static_cast<double>(y), dist(rng)});
+    }
+  }
+
+  const auto indices = grid_indices();
+  const auto count = indices.size() / 3;
+
+  auto planes = std::vector<G3::plane>(count);
+
+  benchmark::run("wedge(wedge(p0, p1), p2)", count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      planes[i] = wedge(
+          wedge(points[indices[3 * i]], points[indices[3 * i + 1]]),
+          points[indices[3 * i + 2]]);
+    }
+    benchmark::do_not_optimize(planes);
+  });
+
+  auto vertex_columns = columns<G3::point>(points.size());
+  auto plane_columns = columns<G3::plane>(count);
+
+  const auto vertices = soa_span<G3::point>{vertex_columns};
+  const auto out = soa_span<G3::plane>{plane_columns};
+
+  for (auto i = 0UZ; i != points.size(); ++i) {
+    vertices.store(i, points[i]);
+  }
+
+  const auto max_threads =
+      std::max(1U, std::thread::hardware_concurrency());
+
+  for (auto threads = 1U; threads <= max_threads; threads *= 2U) {
+    benchmark::run(
+        std::format("join_triangles ({} threads)", threads), count, [&] {
+          join_triangles(
+              vertices, std::span<const std::uint32_t>{indices}, out, threads);
+          benchmark::do_not_optimize(plane_columns);
+        });
+  }
+}
@@ -0,0 +1,101 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+using point = G3::point::multivector_type;
+using line = G3::line::multivector_type;
+using motor = G3::motor::multivector_type;
+
+constexpr auto count = 4096UZ;
+
+// number of motors in batches larger than the last-level cache
+constexpr auto batch_count = 1UZ << 20;
+
+auto rng = std::mt19937{0};
+auto dist = std::uniform_real_distribution{-1.0, 1.0};
+
+template <class V>
+auto make_random(std::size_t n = count) -> std::vector<V>
+{
+  auto values = std::vector<V>(n);
+  for (auto& v : values) {
+    [&v]<std::size_t... Is>(std::index_sequence<Is...>) {
+      ((v.template get<Is>().coefficient = dist(rng)), ...);
+    }(std::make_index_sequence<V::size>{});
+  }
+  return values;
+}
+
+template <class F>
+auto run_op(std::string_view name, const auto& x, const auto& y, F f) -> void
+{
+  auto out = std::vector<decltype(f(x[0], y[0]))>(count);
+
+  benchmark::run(name, count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      out[i] = f(x[i], y[i]);
+    }
+    benchmark::do_not_optimize(out);
+  });
+}
+
+}  // namespace
+
+// element-wise operations from `derive_vector_space_operations` and
+// `multivector_sum`, which vectorize when coefficients are contiguous
+auto main() -> int
+{
+  using ::rigid_geometric_algebra::axpy;
+
+  const auto motors1 = make_random<motor>();
+  const auto motors2 = make_random<motor>();
+  const auto points = make_random<point>();
+  const auto lines = make_random<line>();
+  const auto scalars = [] {
+    auto s = std::vector<double>(count);
+    for (auto& x : s) {
+      x = dist(rng);
+    }
+    return s;
+  }();
+
+  run_op("motor + motor", motors1, motors2, std::plus<>{});
+  run_op("motor - motor", motors1, motors2, std::minus<>{});
+  run_op("scalar * motor", scalars, motors1, std::multiplies<>{});
+  run_op("-motor", motors1, motors2, [](const auto& x, const auto&) {
+    return -x;
+  });
+  run_op("motor + line (multivector_sum)", motors1, lines, std::plus<>{});
+  run_op("point + line (multivector_sum)", points, lines, std::plus<>{});
+
+
+  // `0.5 * xs + ys` over a batch writes and rereads the scaled motors, while
+  // `axpy` reads each motor of `xs` and `ys` once and writes `ys` in place
+  const auto xs = make_random<motor>(batch_count);
+  auto ys = make_random<motor>(batch_count);
+  auto scaled = std::vector<motor>(batch_count);
+
+  benchmark::run("0.5 * motors + motors (two passes)", batch_count, [&] {
+    std::ranges::transform(
+        xs, scaled.begin(), [](const auto& x) { return 0.5 * x; });
+    std::ranges::transform(scaled, ys, ys.begin(), std::plus<>{});
+    benchmark::do_not_optimize(ys);
+  });
+  benchmark::run("axpy(0.5, motors, motors) (span)", batch_count, [&] {
+    axpy(0.5, std::span{xs}, std::span{ys});
+    benchmark::do_not_optimize(ys);
+  });
+}
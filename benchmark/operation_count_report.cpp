@@ -0,0 +1,160 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// prints the number of arithmetic operations performed by each operator for
+// each pair of geometric types of `algebra<double, N>`, N = 2, 3, 4
+//
+// run with
+// ```
+// bazel run //benchmark:operation_count_report
+// ```
+
+namespace {
+
+using ::rigid_geometric_algebra::algebra;
+using ::rigid_geometric_algebra::algebra_dimension_v;
+using ::rigid_geometric_algebra::counted;
+using ::rigid_geometric_algebra::operation_counts;
+
+using C = counted<double>;
+
+template <class T>
+struct named
+{
+  using type = T;
+  std::string_view name;
+};
+
+// geometric types defined for an algebra
+template <class A>
+auto geometric_types()
+{
+  constexpr auto dimension = algebra_dimension_v<A>;
+
+  const auto point = std::tuple{named<typename A::point>{"point"}};
+
+  if constexpr (dimension > 3) {
+    return std::tuple_cat(
+        point,
+        std::tuple{
+            named<typename A::line>{"line"},
+            named<typename A::plane>{"plane"},
+            named<typename A::motor>{"motor"}});
+  } else if constexpr (dimension > 2) {
+    return std::tuple_cat(
+        point,
+        std::tuple{
+            named<typename A::line>{"line"},
+            named<typename A::motor>{"motor"}});
+  } else {
+    return point;
+  }
+}
+
+// multivector with all coefficients equal to one
+template <class T>
+auto ones() -> typename T::multivector_type
+{
+  using V = typename T::multivector_type;
+  return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    return V{(static_cast<void>(Is), C{1.})...};
+  }(std::make_index_sequence<V::size>{});
+}
+
+template <class... Ts>
+auto print_row(const Ts&... columns) -> void
+{
+  std::cout << std::format(
+      "{:>2}  {:<18}{:<8}{:<8}{:>6}{:>6}{:>6}{:>6}{:>6}{:>8}\n", columns...);
+}
+
+template <class Tuple, class F>
+auto for_each(const Tuple& t, F f) -> void
+{
+  std::apply([&f](const auto&... xs) { (f(xs), ...); }, t);
+}
+
+template <class F, class... Ts>
+auto count(F f, const Ts&... xs) -> operation_counts
+{
+  C::reset();
+  static_cast<void>(f(xs...));
+  return C::counts();
+}
+
+template <std::size_t N>
+auto report() -> void
+{
+  using A = algebra<C, N>;
+
+  static constexpr auto unary = std::tuple{
+      std::pair{"left_complement", ::rigid_geometric_algebra::left_complement},
+      std::pair{
+          "right_complement", ::rigid_geometric_algebra::right_complement}};
+
+  static constexpr auto binary = std::tuple{
+      std::pair{"wedge", ::rigid_geometric_algebra::wedge},
+      std::pair{"antiwedge", ::rigid_geometric_algebra::antiwedge},
+      std::pair{"multivector_sum", std::plus<>{}}};
+
+  const auto types = geometric_types<A>();
+
+  const auto print = [](const auto& op, const auto& counts, const auto&... xs) {
+    print_row(
+        N,
+        op.first,
+        xs.name...,
+        counts.additions,
+        counts.subtractions,
+        counts.multiplications,
+        counts.divisions,
+        counts.negations,
+        counts.total());
+  };
+
+  for_each(unary, [&](const auto& op) {
+    for_each(types, [&](const auto& x) {
+      using X = typename std::remove_cvref_t<decltype(x)>::type;
+      print(op, count(op.second, ones<X>()), x, named<void>{""});
+    });
+  });
+
+  for_each(binary, [&](const auto& op) {
+    for_each(types, [&](const auto& x) {
+      for_each(types, [&](const auto& y) {
+        using X = typename std::remove_cvref_t<decltype(x)>::type;
+        using Y = typename std::remove_cvref_t<decltype(y)>::type;
+        print(op, count(op.second, ones<X>(), ones<Y>()), x, y);
+      });
+    });
+  });
+}
+
+}  // namespace
+
+auto main() -> int
+{
+  print_row(
+      "N",
+      "operator",
+      "lhs",
+      "rhs",
+      "add",
+      "sub",
+      "mul",
+      "div",
+      "neg",
+      "total");
+
+  report<2>();
+  report<3>();
+  report<4>();
+}
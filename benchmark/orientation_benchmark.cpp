@@ -0,0 +1,99 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+using ::rigid_geometric_algebra::orientation;
+using ::rigid_geometric_algebra::orientation_stage;
+
+constexpr auto count = 4096UZ;
+
+auto rng = std::mt19937{0};
+auto dist = std::uniform_real_distribution{-1.0, 1.0};
+
+auto random_point() -> G3::point
+{
+  return {1, dist(rng), dist(rng), dist(rng)};
+}
+
+// point on a plane through the origin, up to rounding
+auto coplanar_point(
+    const std::array<double, 3>& u, const std::array<double, 3>& v)
+    -> G3::point
+{
+  const auto s = dist(rng);
+  const auto t = dist(rng);
+  const auto x = [&](std::size_t i) { return (s * u[i]) + (t * v[i]); };
+  return {1, x(0), x(1), x(2)};
+}
+
+// point with integer coordinates on the plane z = x + y
+auto grid_point() -> G3::point
+{
+  auto i = std::uniform_int_distribution{-1000, 1000};
+  const auto x = double(i(rng));
+  const auto y = double(i(rng));
+  return {1, x, y, x + y};
+}
+
+template <class F>
+auto run_case(std::string_view name, F make_point) -> void
+{
+  const auto p0 = make_point();
+  const auto p1 = make_point();
+  const auto p2 = make_point();
+
+  auto points = std::vector<G3::point>(count);
+  for (auto& p : points) {
+    p = make_point();
+  }
+
+  auto results = std::vector<std::partial_ordering>(
+      count, std::partial_ordering::unordered);
+  auto stages = std::vector<orientation_stage>(count);
+
+  benchmark::run(std::format("orientation {}", name), count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      results[i] = orientation(stages[i], p0, p1, p2, points[i]);
+    }
+    benchmark::do_not_optimize(results);
+  });
+
+  auto fallbacks = 0UZ;
+  auto undecided = 0UZ;
+  for (auto i = 0UZ; i != count; ++i) {
+    fallbacks += stages[i] == orientation_stage::interval ? 1 : 0;
+    undecided += results[i] == std::partial_ordering::unordered ? 1 : 0;
+  }
+
+  std::cout << std::format(
+      "{:<48}{:>9.1f} % interval{:>11.1f} % undecided\n",
+      "",
+      100.0 * double(fallbacks) / double(count),
+      100.0 * double(undecided) / double(count));
+}
+
+}  // namespace
+
+auto main() -> int
+{
+  run_case("random", random_point);
+
+  const auto u = std::array{dist(rng), dist(rng), dist(rng)};
+  const auto v = std::array{dist(rng), dist(rng), dist(rng)};
+  run_case("nearly coplanar", [&] { return coplanar_point(u, v); });
+
+  run_case("coplanar grid", grid_point);
+}
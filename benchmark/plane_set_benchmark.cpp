@@ -0,0 +1,95 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+#include "support/soa_columns.hpp"
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+using ::rigid_geometric_algebra::antiwedge;
+using ::rigid_geometric_algebra::containment;
+using ::rigid_geometric_algebra::plane_set;
+using ::rigid_geometric_algebra::soa_span;
+using ::support::columns;
+
+constexpr auto count = 1'000'000UZ;
+
+// frustum with a 90 degree field of view along z, with 1 <= z <= 100
+const auto frustum_planes = std::array{
+    G3::plane{0, 0, -1, 1},
+    G3::plane{0, 0, 1, -100},
+    G3::plane{1, 0, -1, 0},
+    G3::plane{-1, 0, -1, 0},
+    G3::plane{0, 1, -1, 0},
+    G3::plane{0, -1, -1, 0}};
+
+}  // namespace
+
+// culling of points and axis-aligned bounding boxes against the planes of a
+// frustum, testing each plane with `antiwedge` from an array of points and
+// with a transposed `plane_set` from coefficient arrays
+auto main() -> int
+{
+  auto rng = std::mt19937{0};
+  auto position = std::uniform_real_distribution{-100.0, 100.0};
+  auto size = std::uniform_real_distribution{0.0, 2.0};
+
+  auto centers = std::vector<G3::point>{};
+  auto extents = std::vector<G3::point>{};
+  centers.reserve(count);
+  extents.reserve(count);
+  for (auto i = 0UZ; i != count; ++i) {
+    centers.push_back(
+        G3::point{1.0, position(rng), position(rng), position(rng)});
+    extents.push_back(G3::point{0.0, size(rng), size(rng), size(rng)});
+  }
+
+  auto out = std::vector<containment>(count);
+
+  benchmark::run("antiwedge(plane, point)", count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      auto outside = false;
+      auto inside = true;
+      for (const auto& g : frustum_planes) {
+        const auto s = antiwedge(g.multivector(), centers[i].multivector())
+                           .template get<0>()
+                           .coefficient;
+        outside = outside or s > 0.0;
+        inside = inside and s < 0.0;
+      }
+      out[i] = outside  ? containment::outside
+               : inside ? containment::inside
+                        : containment::straddling;
+    }
+    benchmark::do_not_optimize(out);
+  });
+
+  auto center_columns = columns<G3::point>(count);
+  auto extent_columns = columns<G3::point>(count);
+  const auto center_span = soa_span<G3::point>{center_columns};
+  const auto extent_span = soa_span<G3::point>{extent_columns};
+
+  for (auto i = 0UZ; i != count; ++i) {
+    center_span.store(i, centers[i]);
+    extent_span.store(i, extents[i]);
+  }
+
+  const auto frustum = plane_set<G3, 6>{frustum_planes};
+
+  benchmark::run("plane_set::classify(points)", count, [&] {
+    frustum.classify(center_span, std::span{out});
+    benchmark::do_not_optimize(out);
+  });
+
+  benchmark::run("plane_set::classify(centers, extents)", count, [&] {
+    frustum.classify(center_span, extent_span, std::span{out});
+    benchmark::do_not_optimize(out);
+  });
+}
@@ -0,0 +1,112 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+#include "support/soa_columns.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+using ::rigid_geometric_algebra::skin;
+using ::rigid_geometric_algebra::soa_span;
+using ::rigid_geometric_algebra::transform;
+using ::rigid_geometric_algebra::weight_norm;
+using ::support::columns;
+
+constexpr auto vertex_count = 1UZ << 20U;
+constexpr auto bone_count = 64UZ;
+constexpr auto influences = 4UZ;
+
+}  // namespace
+
+// skinning of a mesh with four bone influences per vertex, blending motors
+// and applying the generic sandwich product per vertex from arrays of points
+// and with `skin` from vertex coefficient arrays
+auto main() -> int
+{
+  using ::rigid_geometric_algebra::exp;
+
+  auto rng = std::mt19937{0};
+  auto dist = std::uniform_real_distribution{-1.0, 1.0};
+  auto weight = std::uniform_real_distribution{0.0, 1.0};
+  auto bone = std::uniform_int_distribution<std::uint16_t>{0, bone_count - 1};
+
+  const auto point = [&] {
+    return G3::point{1.0, dist(rng), dist(rng), dist(rng)};
+  };
+
+  auto palette = std::vector<G3::motor>{};
+  for (auto i = 0UZ; i != bone_count; ++i) {
+    palette.push_back(exp(point() ^ point()));
+  }
+
+  auto points = std::vector<G3::point>{};
+  auto weights = std::vector<std::array<double, influences>>{};
+  auto indices = std::vector<std::array<std::uint16_t, influences>>{};
+  points.reserve(vertex_count);
+  weights.reserve(vertex_count);
+  indices.reserve(vertex_count);
+  for (auto i = 0UZ; i != vertex_count; ++i) {
+    points.push_back(point());
+    weights.push_back({weight(rng), weight(rng), weight(rng), weight(rng)});
+    indices.push_back({bone(rng), bone(rng), bone(rng), bone(rng)});
+  }
+
+  auto results = std::vector<G3::point>(vertex_count);
+
+  benchmark::run("transform(blend(motors), point)", vertex_count, [&] {
+    for (auto i = 0UZ; i != vertex_count; ++i) {
+      const auto& first = palette[indices[i][0]].multivector();
+
+      auto q = G3::motor::multivector_type{};
+      for (auto k = 0UZ; k != influences; ++k) {
+        const auto& m = palette[indices[i][k]].multivector();
+        const auto dot = m.get<1>().coefficient * first.get<1>().coefficient +
+                         m.get<2>().coefficient * first.get<2>().coefficient +
+                         m.get<3>().coefficient * first.get<3>().coefficient +
+                         m.get<7>().coefficient * first.get<7>().coefficient;
+        q = q + (dot < 0.0 ? -weights[i][k] : weights[i][k]) * m;
+      }
+
+      const auto n = weight_norm(q);
+      results[i] = transform(G3::motor{(1.0 / n) * q}, points[i]);
+    }
+    benchmark::do_not_optimize(results);
+  });
+
+  auto vertex_columns = columns<G3::point>(vertex_count);
+  auto out_columns = columns<G3::point>(vertex_count);
+  const auto vertices = soa_span<G3::point>{vertex_columns};
+  const auto out = soa_span<G3::point>{out_columns};
+
+  for (auto i = 0UZ; i != vertex_count; ++i) {
+    vertices.store(i, points[i]);
+  }
+
+  const auto max_threads =
+      std::max(1U, std::thread::hardware_concurrency());
+
+  for (auto threads = 1U; threads <= max_threads; threads *= 2U) {
+    benchmark::run(
+        std::format("skin ({} threads)", threads), vertex_count, [&] {
+          skin(
+              std::span<const G3::motor>{palette},
+              std::span<const std::array<double, influences>>{weights},
+              std::span<const std::array<std::uint16_t, influences>>{indices},
+              soa_span<const G3::point>{vertices},
+              out,
+              threads);
+          benchmark::do_not_optimize(out_columns);
+        });
+  }
+}
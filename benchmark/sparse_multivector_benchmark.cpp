@@ -0,0 +1,101 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include "benchmark/harness.hpp"
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+using ::rigid_geometric_algebra::geometric_product;
+using ::rigid_geometric_algebra::to_multivector;
+using ::rigid_geometric_algebra::wedge;
+
+using sparse = ::rigid_geometric_algebra::sparse_multivector<G3>;
+
+// every blade of G3
+using dense = decltype(G3::point::multivector_type{} +
+                       G3::plane::multivector_type{} +
+                       G3::motor::multivector_type{});
+
+constexpr auto count = 4096UZ;
+
+auto rng = std::mt19937{0};
+auto dist = std::uniform_real_distribution{-1.0, 1.0};
+
+// multivectors where each blade is present with probability `density`, as
+// a dense multivector with zero coefficients for absent blades and as a
+// sparse multivector storing only present blades
+auto make_random(double density)
+    -> std::pair<std::vector<dense>, std::vector<sparse>>
+{
+  auto present = std::bernoulli_distribution{density};
+
+  auto values = std::pair<std::vector<dense>, std::vector<sparse>>{};
+  values.first.reserve(count);
+  values.second.reserve(count);
+
+  for (auto i = 0UZ; i != count; ++i) {
+    auto& d = values.first.emplace_back();
+    auto& s = values.second.emplace_back();
+
+    [&d, &s, &present]<class... Bs>(
+        ::rigid_geometric_algebra::detail::type_list<Bs...>) {
+      const auto add = [&d, &s, &present]<class B>(std::type_identity<B>) {
+        if (present(rng)) {
+          d.template get<B>().coefficient = dist(rng);
+          s = s + sparse{to_multivector(d.template get<B>())};
+        }
+      };
+      (add(std::type_identity<Bs>{}), ...);
+    }(dense::blade_list_type{});
+  }
+
+  return values;
+}
+
+template <class F>
+auto run_op(std::string_view name, const auto& x, const auto& y, F f) -> void
+{
+  auto out = std::vector<decltype(f(x[0], y[0]))>(count, f(x[0], y[0]));
+
+  benchmark::run(name, count, [&] {
+    for (auto i = 0UZ; i != count; ++i) {
+      out[i] = f(x[i], y[i]);
+    }
+    benchmark::do_not_optimize(out);
+  });
+}
+
+template <class F>
+auto compare(std::string_view name, double density, F f) -> void
+{
+  const auto [x_dense, x_sparse] = make_random(density);
+  const auto [y_dense, y_sparse] = make_random(density);
+
+  const auto prefix =
+      std::string{name} + " density " + std::to_string(density).substr(0, 4);
+
+  run_op(prefix + " (multivector)", x_dense, y_dense, f);
+  run_op(prefix + " (sparse)", x_sparse, y_sparse, f);
+}
+
+}  // namespace
+
+// products of `sparse_multivector`, iterating over the blades present in
+// each operand, compared to the same products of a `multivector` with every
+// blade of the algebra, for operands with randomly chosen blades
+auto main() -> int
+{
+  for (const auto density : {0.125, 0.25, 0.5, 1.0}) {
+    compare("geometric_product", density, geometric_product);
+    compare("wedge", density, wedge);
+  }
+}
@@ -0,0 +1,110 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rga = ::rigid_geometric_algebra;
+
+namespace {
+
+using A = rga::algebra<double, 3>;
+
+using point = A::point::multivector_type;
+using line = A::line::multivector_type;
+using plane = A::plane::multivector_type;
+using motor = A::motor::multivector_type;
+
+constexpr auto count = 16UZ;
+
+template <class V>
+auto coefficients(const V& v) -> std::string
+{
+  auto s = std::string{};
+  for (const auto c : v.coefficients()) {
+    s += std::format(" {}", c);
+  }
+  return s;
+}
+
+// prints a line for each pair of elements, holding the operator name and
+// the coefficients of `a`, `b`, and `f(a, b)` converted to `R`, as the
+// batched operators in `rigid_geometric_algebra_ext` convert results
+template <class R, class V1, class V2, class F>
+auto print(
+    std::string_view name,
+    const std::vector<V1>& as,
+    const std::vector<V2>& bs,
+    F f) -> void
+{
+  for (auto i = 0UZ; i != as.size(); ++i) {
+    const R r = f(as[i], bs[i]);
+    std::cout << name << coefficients(as[i]) << coefficients(bs[i])
+              << coefficients(r) << '\n';
+  }
+}
+
+}  // namespace
+
+// reference values for `rigid_geometric_algebra_ext_test`, computed one
+// element at a time with the operators wrapped by `rigid_geometric_algebra_ext`
+auto main() -> int
+{
+  auto rng = std::mt19937{0};
+  auto coordinate = std::uniform_real_distribution{-2.0, 2.0};
+  auto weight = std::uniform_real_distribution{0.5, 2.0};
+
+  const auto random_point = [&] {
+    return A::point{
+        weight(rng), coordinate(rng), coordinate(rng), coordinate(rng)}
+        .multivector();
+  };
+  const auto random_plane = [&] {
+    return A::plane{
+        coordinate(rng), coordinate(rng), coordinate(rng), coordinate(rng)}
+        .multivector();
+  };
+  const auto random_motor = [&] {
+    return rga::exp(
+               line{
+                   coordinate(rng),
+                   coordinate(rng),
+                   coordinate(rng),
+                   coordinate(rng),
+                   coordinate(rng),
+                   coordinate(rng)})
+        .multivector();
+  };
+
+  auto ps = std::vector<point>{};
+  auto qs = std::vector<point>{};
+  auto gs = std::vector<plane>{};
+  auto hs = std::vector<plane>{};
+  auto ls = std::vector<line>{};
+  auto ms = std::vector<motor>{};
+
+  for (auto i = 0UZ; i != count; ++i) {
+    ps.push_back(random_point());
+    qs.push_back(random_point());
+    gs.push_back(random_plane());
+    hs.push_back(random_plane());
+    ls.push_back(rga::wedge(random_point(), random_point()));
+    ms.push_back(random_motor());
+  }
+
+  print<line>("wedge_point_point", ps, qs, rga::wedge);
+  print<plane>("wedge_line_point", ls, ps, rga::wedge);
+  print<plane>("wedge_point_line", ps, ls, rga::wedge);
+
+  print<line>("antiwedge_plane_plane", gs, hs, rga::antiwedge);
+  print<point>("antiwedge_line_plane", ls, gs, rga::antiwedge);
+  print<point>("antiwedge_plane_line", gs, ls, rga::antiwedge);
+
+  print<point>("transform_point", ms, ps, rga::transform);
+  print<line>("transform_line", ms, ls, rga::transform);
+  print<plane>("transform_plane", ms, gs, rga::transform);
+}
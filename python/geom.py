@@ -1,8 +1,9 @@
-from collections.abc import Iterable
+from collections.abc import Callable, Iterable
 from dataclasses import dataclass
 
 import matplotlib.pyplot as plt
 import numpy as np
+import rigid_geometric_algebra_ext as ext
 from matplotlib.axes import Axes
 from matplotlib.collections import PathCollection, PolyCollection
 from mpl_toolkits.mplot3d.art3d import Line3DCollection, Poly3DCollection
@@ -145,13 +146,260 @@ class Plane(_Data):
         return ax.add_collection(planes)
 
 
-def plot(data: Iterable[_Data]) -> plt.Figure:
+# batched operator of `rigid_geometric_algebra_ext`
+_Operator = Callable[[np.ndarray, np.ndarray], np.ndarray]
+
+# batched operators, by the number of coefficients of each argument
+_WEDGE: dict[tuple[int, int], _Operator] = {
+    (4, 4): ext.wedge_point_point,
+    (6, 4): ext.wedge_line_point,
+    (4, 6): ext.wedge_point_line,
+}
+_ANTIWEDGE: dict[tuple[int, int], _Operator] = {
+    (4, 4): ext.antiwedge_plane_plane,
+    (6, 4): ext.antiwedge_line_plane,
+    (4, 6): ext.antiwedge_plane_line,
+}
+_TRANSFORM: dict[type[_Data], _Operator] = {
+    Point: ext.transform_point,
+    Line: ext.transform_line,
+    Plane: ext.transform_plane,
+}
+
+
+def _batched(
+    operators: dict[tuple[int, int], _Operator], a: np.ndarray, b: np.ndarray
+) -> np.ndarray:
+    a = np.asarray(a, dtype=np.float64)
+    b = np.asarray(b, dtype=np.float64)
+    f = operators.get((a.shape[-1], b.shape[-1]))
+    require(
+        f is not None,
+        f"no operator for arrays with {a.shape[-1]} and {b.shape[-1]} columns",
+    )
+    return f(a, b)
+
+
+def wedge(a: np.ndarray, b: np.ndarray) -> np.ndarray:
+    """Join arrays of elements with the C++ batched operators.
+
+    Two `(N, 4)` arrays of points give an `(N, 6)` array of lines. An `(N, 6)`
+    array of lines and an `(N, 4)` array of points, in either order, give an
+    `(N, 4)` array of planes. An array with a single row is joined with every
+    row of the other array.
+    """
+    return _batched(_WEDGE, a, b)
+
+
+def antiwedge(a: np.ndarray, b: np.ndarray) -> np.ndarray:
+    """Meet arrays of elements with the C++ batched operators.
+
+    Two `(N, 4)` arrays of planes give an `(N, 6)` array of lines. An `(N, 6)`
+    array of lines and an `(N, 4)` array of planes, in either order, give an
+    `(N, 4)` array of points. An array with a single row is met with every row
+    of the other array.
+    """
+    return _batched(_ANTIWEDGE, a, b)
+
+
+def transform(
+    motors: np.ndarray, elements: np.ndarray, kind: type[_Data]
+) -> np.ndarray:
+    """Transform an array of elements of `kind` by an `(N, 8)` array of motors.
+
+    A single motor transforms every element, and a single element is
+    transformed by every motor.
+    """
+    return _TRANSFORM[kind](
+        np.asarray(motors, dtype=np.float64), np.asarray(elements, dtype=np.float64)
+    )
+
+
+# lower and upper corners of an axis-aligned box
+Bounds = tuple[np.ndarray, np.ndarray]
+
+# vertex index pairs of the edges of a box, with vertex `i` at the corner
+# selecting the upper bound along axis `j` if bit `j` of `i` is set
+_BOX_EDGES = np.array(
+    [(i, i | (1 << j)) for i in range(8) for j in range(3) if not i & (1 << j)]
+)
+
+
+def _rows(data: np.ndarray | None, size: int) -> np.ndarray:
+    if data is None:
+        return np.empty((0, size))
+    return np.asarray(data, dtype=np.float64).reshape(-1, size)
+
+
+def _decimate(data: np.ndarray, max_count: int | None) -> np.ndarray:
+    if max_count is None or len(data) <= max_count:
+        return data
+    require(max_count >= 0, "`max_per_kind` must be nonnegative")
+    if max_count == 0:
+        return data[:0]
+    return data[:: -(-len(data) // max_count)]
+
+
+def _default_bounds(points: np.ndarray) -> Bounds:
+    lower = np.minimum(points.min(axis=0, initial=-1), -1)
+    upper = np.maximum(points.max(axis=0, initial=1), 1)
+    margin = 0.1 * (upper - lower)
+    return lower - margin, upper + margin
+
+
+def cartesian_points(points: np.ndarray) -> np.ndarray:
+    """Divide `(N, 4)` homogeneous points by their weight.
+
+    Points at infinity are dropped.
+    """
+    w = points[:, 0]
+    finite = w != 0
+    return points[finite, 1:] / w[finite, np.newaxis]
+
+
+def clip_lines(lines: np.ndarray, bounds: Bounds) -> np.ndarray:
+    """Clip `(N, 6)` lines to a box, returning `(M, 2, 3)` segments.
+
+    Lines that miss the box are dropped.
+    """
+    direction = lines[:, :3]
+    moment = lines[:, 3:]
+    vv = np.einsum("ij,ij->i", direction, direction)
+    direction = direction[vv != 0]
+    moment = moment[vv != 0]
+    vv = vv[vv != 0]
+
+    # point on each line closest to the origin
+    p = np.cross(direction, moment) / vv[:, np.newaxis]
+
+    # intersect the parameter ranges within each pair of bounding planes
+    lower, upper = bounds
+    with np.errstate(divide="ignore", invalid="ignore"):
+        t_lower = (lower - p) / direction
+        t_upper = (upper - p) / direction
+    parallel = direction == 0
+    inside = (lower <= p) & (p <= upper)
+    t_near = np.where(
+        parallel,
+        np.where(inside, -np.inf, np.inf),
+        np.minimum(t_lower, t_upper),
+    )
+    t_far = np.where(
+        parallel,
+        np.where(inside, np.inf, -np.inf),
+        np.maximum(t_lower, t_upper),
+    )
+    t0 = t_near.max(axis=1)
+    t1 = t_far.min(axis=1)
+
+    hit = t0 < t1
+    t = np.stack([t0[hit], t1[hit]], axis=1)
+    return p[hit, np.newaxis] + t[..., np.newaxis] * direction[hit, np.newaxis]
+
+
+def clip_planes(planes: np.ndarray, bounds: Bounds) -> np.ndarray:
+    """Clip `(N, 4)` planes to a box, returning `(M, 12, 3)` polygons.
+
+    Each polygon contains the intersections of a plane with the edges of the
+    box, ordered around the plane normal. Polygons with fewer vertices repeat
+    their last vertex. Planes that miss the box are dropped.
+    """
+    normal = planes[:, :3]
+    w = planes[:, 3]
+
+    corners = np.where(
+        (np.arange(8)[:, np.newaxis] >> np.arange(3)) & 1, bounds[1], bounds[0]
+    )
+    a = corners[_BOX_EDGES[:, 0]]
+    b = corners[_BOX_EDGES[:, 1]]
+
+    # signed distances, scaled by the normal norm, of the edge endpoints
+    sa = normal @ a.T + w[:, np.newaxis]
+    sb = normal @ b.T + w[:, np.newaxis]
+    crossing = (sa * sb <= 0) & (sa != sb)
+
+    with np.errstate(divide="ignore", invalid="ignore"):
+        t = np.where(crossing, sa / (sa - sb), 0)
+    vertices = a + t[..., np.newaxis] * (b - a)
+
+    count = crossing.sum(axis=1)
+    hit = count >= 3  # noqa: PLR2004
+    normal = normal[hit]
+    vertices = vertices[hit]
+    crossing = crossing[hit]
+    count = count[hit]
+
+    # in-plane basis from the axis least aligned with the normal
+    axis = np.eye(3)[np.abs(normal).argmin(axis=1)]
+    u = np.cross(normal, axis)
+    v = np.cross(normal, u)
+
+    center = (vertices * crossing[..., np.newaxis]).sum(axis=1)
+    center /= count[:, np.newaxis]
+    d = vertices - center[:, np.newaxis]
+    angle = np.arctan2(np.einsum("nkj,nj->nk", d, v), np.einsum("nkj,nj->nk", d, u))
+    order = np.argsort(np.where(crossing, angle, np.inf), axis=1)
+    last = np.minimum(np.arange(order.shape[1]), count[:, np.newaxis] - 1)
+    order = np.take_along_axis(order, last, axis=1)
+    return np.take_along_axis(vertices, order[..., np.newaxis], axis=1)
+
+
+def plot_arrays(
+    points: np.ndarray | None = None,
+    lines: np.ndarray | None = None,
+    planes: np.ndarray | None = None,
+    *,
+    bounds: Bounds | None = None,
+    max_per_kind: int | None = None,
+) -> plt.Figure:
+    """Plot arrays of elements with one artist per kind of element.
+
+    `points`, `lines`, and `planes` contain one element per row. Lines and
+    planes are clipped to `bounds`, which defaults to a box containing the
+    points and the unit cube. If `max_per_kind` is given, larger arrays are
+    decimated to at most that many elements, with zero drawing no elements.
+    """
+    points = cartesian_points(_decimate(_rows(points, 4), max_per_kind))
+    lines = _decimate(_rows(lines, 6), max_per_kind)
+    planes = _decimate(_rows(planes, 4), max_per_kind)
+
+    if bounds is None:
+        bounds = _default_bounds(points)
+    lower, upper = (np.asarray(b, dtype=np.float64) for b in bounds)
+
     fig, ax = plt.subplots(subplot_kw={"projection": "3d"})
     ax.set_xlabel("x")
     ax.set_ylabel("y")
     ax.set_zlabel("z")
+    ax.set_xlim(lower[0], upper[0])
+    ax.set_ylim(lower[1], upper[1])
+    ax.set_zlim(lower[2], upper[2])
 
-    for p in data:
-        p.add_to(ax)
+    if len(points):
+        ax.scatter(*points.T)
+    if len(segments := clip_lines(lines, (lower, upper))):
+        ax.add_collection(Line3DCollection(segments))
+    if len(polygons := clip_planes(planes, (lower, upper))):
+        ax.add_collection(Poly3DCollection(polygons, alpha=0.3))
 
     return fig
+
+
+def plot(
+    data: Iterable[_Data],
+    *,
+    bounds: Bounds | None = None,
+    max_per_kind: int | None = None,
+) -> plt.Figure:
+    elements = list(data)
+
+    def stack(kind: type[_Data]) -> list[np.ndarray]:
+        return [e.view for e in elements if isinstance(e, kind)]
+
+    return plot_arrays(
+        _rows(stack(Point), 4),
+        _rows(stack(Line), 6),
+        _rows(stack(Plane), 4),
+        bounds=bounds,
+        max_per_kind=max_per_kind,
+    )
@@ -5,20 +5,41 @@ import sys
 from collections.abc import Iterable
 
 import matplotlib.pyplot as plt
+import numpy as np
 
 from python import geom
 
+# number of points defining each kind of element
+KINDS = {"point": 1, "line": 2, "plane": 3}
 
-def parse(raw: dict[str, Iterable[float]]) -> geom.Point:
-    if len(raw) != 1:
-        msg = "`raw` must contain a single item"
-        raise ValueError(msg)
 
-    k, v = next(iter(raw.items()))
+def parse(raw_values: Iterable[dict[str, list]]) -> dict[str, np.ndarray]:
+    """Group elements by kind into `(N, m, 4)` arrays of their defining points."""
+    groups: dict[str, list[list]] = {kind: [] for kind in KINDS}
+    for raw in raw_values:
+        if len(raw) != 1:
+            msg = "`raw` must contain a single item"
+            raise ValueError(msg)
+
+        [(k, v)] = raw.items()
+        groups[k].append(v)
 
     return {
-        "point": geom.Point,
-    }[k](v)
+        kind: np.array(groups[kind], dtype=np.float64).reshape(-1, m, 4)
+        for kind, m in KINDS.items()
+    }
+
+
+def elements(groups: dict[str, np.ndarray]) -> dict[str, np.ndarray]:
+    """Join the defining points of lines and planes with the C++ operators."""
+    p, q = groups["line"].transpose(1, 0, 2)
+    r, s, t = groups["plane"].transpose(1, 0, 2)
+
+    return {
+        "points": groups["point"][:, 0],
+        "lines": geom.wedge(p, q),
+        "planes": geom.wedge(geom.wedge(r, s), t),
+    }
 
 
 if __name__ == "__main__":
@@ -27,18 +48,24 @@ if __name__ == "__main__":
     except FileNotFoundError:
         print(
             """\
-Plot points encoded as JSON.
+Plot points, lines, and planes encoded as JSON.
 
 bazel run //python:plot -- [files...]
 
 Plots the first line of all files listed in sys.argv[1:], defaulting
 to sys.stdin if the list is empty. If a filename is '-',  it is also
 replaced with sys.stdin.
+
+The line holds a list of elements, each an object with a single item.
+Points are given by their coordinates, lines by two points, and planes
+by three points:
+
+[{"point": [1, 0, 0, 0]}, {"line": [[1, 0, 0, 0], [1, 1, 0, 0]]}]
         """,
             file=sys.stderr,
         )
         sys.exit(1)
 
     raw_values = json.loads(line)
-    fig = geom.plot(map(parse, raw_values))
+    fig = geom.plot_arrays(**elements(parse(raw_values)))
     plt.show()
@@ -0,0 +1,192 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <array>
+#include <cstddef>
+#include <format>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace py = pybind11;
+namespace rga = ::rigid_geometric_algebra;
+
+namespace {
+
+// an `(N, k)` array of any layout, with elements of type `T`
+template <class T>
+using array = py::array_t<T>;
+
+template <class V, class T>
+auto as_soa_span(T* data, std::size_t n) -> rga::soa_span<V>
+{
+  auto columns = std::array<std::span<T>, std::remove_cv_t<V>::size>{};
+  for (auto j = 0UZ; j != columns.size(); ++j) {
+    columns[j] = {data + (j * n), n};
+  }
+  return rga::soa_span<V>{columns};
+}
+
+// views the `k` columns of an `(N, k)` array as a `soa_span`
+//
+// a Fortran-ordered array stores each column contiguously, the layout of a
+// `soa_span`, and is viewed without copying. the columns of an array with any
+// other layout, such as the C order NumPy uses by default, are first copied
+// to `buffer`. only the array data is accessed, so the GIL need not be held.
+//
+template <class V, class T>
+auto as_soa_span(const array<T>& a, std::vector<T>& buffer)
+    -> rga::soa_span<const V>
+{
+  const auto n = static_cast<std::size_t>(a.shape(0));
+
+  if ((a.flags() & py::array::f_style) != 0) {
+    return as_soa_span<const V>(a.data(), n);
+  }
+
+  const auto r = a.template unchecked<2>();
+  buffer.resize(n * V::size);
+  for (auto j = 0UZ; j != V::size; ++j) {
+    for (auto i = 0UZ; i != n; ++i) {
+      buffer[(j * n) + i] =
+          r(static_cast<py::ssize_t>(i), static_cast<py::ssize_t>(j));
+    }
+  }
+  return as_soa_span<const V>(buffer.data(), n);
+}
+
+template <class V, class T>
+auto rows(const array<T>& a, const char* name) -> std::size_t
+{
+  if (a.ndim() != 2 or std::cmp_not_equal(a.shape(1), V::size)) {
+    throw py::value_error{
+        std::format("`{}` must have shape (N, {})", name, V::size)};
+  }
+  return static_cast<std::size_t>(a.shape(0));
+}
+
+// defines `name(a, b)`, invoking `f(a, b, out)` with `soa_span`s viewing the
+// NumPy arrays `a`, `b`, and a newly allocated Fortran-ordered `out`
+//
+// an input with a single row is broadcast to the number of rows of the other
+// input. the GIL is released while inputs that are not Fortran-ordered are
+// copied and while `f` is invoked.
+//
+template <class R, class V1, class V2, class T, class F>
+auto def_batched(py::module_& m, const char* name, const char* doc, F f)
+    -> void
+{
+  m.def(
+      name,
+      [f](const array<T>& a, const array<T>& b) {
+        const auto n1 = rows<V1>(a, "a");
+        const auto n2 = rows<V2>(b, "b");
+
+        if (n1 != n2 and n1 != 1 and n2 != 1) {
+          throw py::value_error{std::format(
+              "number of rows of `a` ({}) and `b` ({}) must match or be 1",
+              n1,
+              n2)};
+        }
+
+        const auto n = (n1 == 1) ? n2 : n1;
+
+        auto result = py::array_t<T, py::array::f_style>{{n, R::size}};
+        const auto out = as_soa_span<R>(result.mutable_data(), n);
+
+        {
+          const auto release = py::gil_scoped_release{};
+
+          auto buffer1 = std::vector<T>{};
+          auto buffer2 = std::vector<T>{};
+          const auto in1 = as_soa_span<V1>(a, buffer1);
+          const auto in2 = as_soa_span<V2>(b, buffer2);
+
+          if (n1 == n2) {
+            f(in1, in2, out);
+          } else if (n1 == 1) {
+            f(in1[0], in2, out);
+          } else {
+            f(in1, in2[0], out);
+          }
+        }
+
+        return result;
+      },
+      py::arg("a").noconvert(),
+      py::arg("b").noconvert(),
+      doc);
+}
+
+template <class T>
+auto def_operators(py::module_& m) -> void
+{
+  using A = rga::algebra<T, 3>;
+
+  using point = typename A::point::multivector_type;
+  using line = typename A::line::multivector_type;
+  using plane = typename A::plane::multivector_type;
+  using motor = typename A::motor::multivector_type;
+
+  def_batched<line, point, point, T>(
+      m, "wedge_point_point", "line through two points", rga::wedge);
+  def_batched<plane, line, point, T>(
+      m, "wedge_line_point", "plane through a line and a point", rga::wedge);
+  def_batched<plane, point, line, T>(
+      m, "wedge_point_line", "plane through a point and a line", rga::wedge);
+
+  def_batched<line, plane, plane, T>(
+      m,
+      "antiwedge_plane_plane",
+      "line of intersection of two planes",
+      rga::antiwedge);
+  def_batched<point, line, plane, T>(
+      m,
+      "antiwedge_line_plane",
+      "point of intersection of a line and a plane",
+      rga::antiwedge);
+  def_batched<point, plane, line, T>(
+      m,
+      "antiwedge_plane_line",
+      "point of intersection of a plane and a line",
+      rga::antiwedge);
+
+  def_batched<point, motor, point, T>(
+      m, "transform_point", "point transformed by a motor", rga::transform);
+  def_batched<line, motor, line, T>(
+      m, "transform_line", "line transformed by a motor", rga::transform);
+  def_batched<plane, motor, plane, T>(
+      m, "transform_plane", "plane transformed by a motor", rga::transform);
+}
+
+}  // namespace
+
+PYBIND11_MODULE(rigid_geometric_algebra_ext, m)
+{
+  m.doc() = R"(batched operators of the rigid geometric algebra
+
+Elements are passed as `(N, k)` NumPy arrays of float64 or float32, with one
+row per element and one column per coefficient in canonical blade order:
+
+* point: e0, e1, e2, e3
+* line: e01, e02, e03, e23, e31, e12
+* plane: e023, e031, e012, e321
+* motor: 1, e01, e02, e03, e23, e31, e12, e0123
+
+Arrays of any layout are accepted. Fortran-ordered arrays (see
+`numpy.asfortranarray`) store each column contiguously and are accessed
+without copying. The columns of arrays of other layouts, including NumPy's
+default C order, are copied before computation. Arrays of another dtype are
+rejected rather than converted. An input with a single row is used for every
+row of the other input. Both inputs must have the same dtype, which is the
+dtype of the result. Results are Fortran-ordered.
+
+The GIL is released during copying and computation.
+)";
+
+  def_operators<double>(m);
+  def_operators<float>(m);
+}
@@ -0,0 +1,151 @@
+import sys
+import tracemalloc
+import unittest
+from pathlib import Path
+
+import numpy as np
+import rigid_geometric_algebra_ext as ext
+
+# number of coefficients of each element type
+SIZES = {"point": 4, "line": 6, "plane": 4, "motor": 8}
+
+# argument and result element types of each batched operator
+OPERATORS = {
+    "wedge_point_point": ("point", "point", "line"),
+    "wedge_line_point": ("line", "point", "plane"),
+    "wedge_point_line": ("point", "line", "plane"),
+    "antiwedge_plane_plane": ("plane", "plane", "line"),
+    "antiwedge_line_plane": ("line", "plane", "point"),
+    "antiwedge_plane_line": ("plane", "line", "point"),
+    "transform_point": ("motor", "point", "point"),
+    "transform_line": ("motor", "line", "line"),
+    "transform_plane": ("motor", "plane", "plane"),
+}
+
+Reference = tuple[np.ndarray, np.ndarray, np.ndarray]
+
+
+def load_reference(path: Path) -> dict[str, Reference]:
+    """Load arguments and results of the C++ operators.
+
+    Each line of the file written by `ext_reference` holds an operator name
+    followed by the coefficients of both arguments and of the result.
+    """
+    rows: dict[str, list[list[float]]] = {}
+    for line in path.read_text().splitlines():
+        name, *values = line.split()
+        rows.setdefault(name, []).append([float(v) for v in values])
+
+    reference = {}
+    for name, (a, b, _) in OPERATORS.items():
+        data = np.array(rows[name])
+        i = SIZES[a]
+        j = i + SIZES[b]
+        reference[name] = (
+            np.asfortranarray(data[:, :i]),
+            np.asfortranarray(data[:, i:j]),
+            data[:, j:],
+        )
+    return reference
+
+
+REFERENCE: dict[str, Reference] = {}
+
+
+class BatchedOperatorTest(unittest.TestCase):
+    def test_float64_matches_cpp_operators(self) -> None:
+        for name, (a, b, expected) in REFERENCE.items():
+            with self.subTest(name):
+                result = getattr(ext, name)(a, b)
+
+                self.assertEqual(result.dtype, np.float64)
+                self.assertTrue(result.flags.f_contiguous)
+                np.testing.assert_allclose(result, expected, rtol=1e-12, atol=1e-12)
+
+    def test_float32_matches_cpp_operators(self) -> None:
+        for name, (a, b, expected) in REFERENCE.items():
+            with self.subTest(name):
+                result = getattr(ext, name)(
+                    a.astype(np.float32, order="F"),
+                    b.astype(np.float32, order="F"),
+                )
+
+                self.assertEqual(result.dtype, np.float32)
+                np.testing.assert_allclose(result, expected, rtol=1e-4, atol=1e-4)
+
+    def test_single_row_is_broadcast(self) -> None:
+        for name, (a, b, _) in REFERENCE.items():
+            with self.subTest(name):
+                f = getattr(ext, name)
+                n = len(b)
+
+                np.testing.assert_allclose(
+                    f(np.asfortranarray(a[:1]), b),
+                    f(np.asfortranarray(np.repeat(a[:1], n, axis=0)), b),
+                    rtol=1e-12,
+                    atol=1e-12,
+                )
+                np.testing.assert_allclose(
+                    f(a, np.asfortranarray(b[:1])),
+                    f(a, np.asfortranarray(np.repeat(b[:1], n, axis=0))),
+                    rtol=1e-12,
+                    atol=1e-12,
+                )
+
+    def test_accepts_arrays_of_any_layout(self) -> None:
+        for name, (a, b, expected) in REFERENCE.items():
+            f = getattr(ext, name)
+
+            for a_arg, b_arg in [
+                (np.ascontiguousarray(a), b),
+                (a, np.ascontiguousarray(b)),
+                (np.ascontiguousarray(a), np.ascontiguousarray(b)),
+                (np.repeat(a, 2, axis=0)[::2], np.repeat(b, 2, axis=1)[:, ::2]),
+            ]:
+                with self.subTest(name):
+                    result = f(a_arg, b_arg)
+
+                    self.assertTrue(result.flags.f_contiguous)
+                    np.testing.assert_allclose(result, expected, rtol=1e-12, atol=1e-12)
+
+    def test_rejects_arrays_that_require_a_conversion(self) -> None:
+        a, b, _ = REFERENCE["wedge_point_point"]
+
+        for a_arg, b_arg in [
+            (a.astype(np.float32, order="F"), b),
+            (a, b.astype(np.float32, order="F")),
+            (a.astype(np.int64, order="F"), b),
+        ]:
+            with self.subTest(), self.assertRaises(TypeError):
+                ext.wedge_point_point(a_arg, b_arg)
+
+    def test_rejects_mismatched_shapes(self) -> None:
+        a, b, _ = REFERENCE["wedge_point_point"]
+
+        with self.assertRaises(ValueError):
+            ext.wedge_point_point(a, np.asfortranarray(b[:2]))
+        with self.assertRaises(ValueError):
+            ext.wedge_point_point(a, np.asfortranarray(b[:, :3]))
+
+    def test_does_not_copy_fortran_input(self) -> None:
+        n = 1 << 20
+        rng = np.random.default_rng(0)
+        a = np.asfortranarray(rng.uniform(-1.0, 1.0, (n, 4)))
+        b = np.asfortranarray(rng.uniform(-1.0, 1.0, (n, 4)))
+
+        # NumPy reports its allocations to tracemalloc, so the peak includes
+        # the result and any copy of an input
+        tracemalloc.start()
+        try:
+            result = ext.wedge_point_point(a, b)
+            _, peak = tracemalloc.get_traced_memory()
+        finally:
+            tracemalloc.stop()
+
+        self.assertGreaterEqual(peak, result.nbytes)
+        self.assertLess(peak, result.nbytes + a.nbytes // 2)
+
+
+if __name__ == "__main__":
+    REFERENCE.update(load_reference(Path(sys.argv[1])))
+    unittest.main(argv=sys.argv[:1])
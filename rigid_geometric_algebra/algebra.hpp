@@ -46,6 +46,8 @@ struct algebra
   using line = ::rigid_geometric_algebra::line<algebra>;
 
   using plane = ::rigid_geometric_algebra::plane<algebra>;
+
+  using motor = ::rigid_geometric_algebra::motor<algebra>;
 };
 
 }  // namespace rigid_geometric_algebra
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "rigid_geometric_algebra/detail/derive_soa_overload.hpp"
+#include "rigid_geometric_algebra/detail/euclidean_vector.hpp"
+#include "rigid_geometric_algebra/homogeneous_magnitude.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/norm.hpp"
+#include "rigid_geometric_algebra/plane.hpp"
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class angle_value_fn
+{
+public:
+  template <class A>
+  static auto operator()(const line<A>& k, const line<A>& l)
+      -> homogeneous_magnitude_t<A>
+  {
+    return homogeneous_magnitude<A>(
+        detail::dot(detail::direction(k), detail::direction(l)),
+        weight_norm(k) * weight_norm(l));
+  }
+
+  template <class A>
+  static auto operator()(const plane<A>& g, const plane<A>& h)
+      -> homogeneous_magnitude_t<A>
+  {
+    return homogeneous_magnitude<A>(
+        detail::dot(detail::normal(g), detail::normal(h)),
+        weight_norm(g) * weight_norm(h));
+  }
+
+  template <class A>
+  static auto operator()(const line<A>& l, const plane<A>& g)
+      -> homogeneous_magnitude_t<A>
+  {
+    return homogeneous_magnitude<A>(
+        detail::cross_norm(detail::direction(l), detail::normal(g)),
+        weight_norm(l) * weight_norm(g));
+  }
+
+  template <class A>
+  static auto operator()(const plane<A>& g, const line<A>& l)
+      -> homogeneous_magnitude_t<A>
+  {
+    return operator()(l, g);
+  }
+};
+
+class angle_fn : public angle_value_fn,
+                 public derive_soa_overload<angle_value_fn>
+{
+public:
+  using angle_value_fn::operator();
+  using derive_soa_overload<angle_value_fn>::operator();
+};
+
+}  // namespace detail
+
+/// cosine of the angle between lines or planes
+/// @param a, b lines or planes
+///
+/// Returns the cosine of the angle between `a` and `b` as a homogeneous
+/// magnitude. The arguments need not be unitized. The numerator is
+/// * the dot product of the directions for two lines
+/// * the dot product of the normals for two planes
+/// * the norm of the cross product of the direction and the normal for a line
+///   and a plane
+///
+/// and the denominator is the product of the weight norms of `a` and `b`.
+/// The sign of the numerator depends on the orientations of two lines or two
+/// planes.
+///
+/// Batches may be evaluated with `angle(as, bs, out)` or, for a single `b`,
+/// with `angle(as, b, out)`, where `as`, `bs`, and `out` are `soa_span`s.
+///
+inline constexpr auto angle = detail::angle_fn{};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "rigid_geometric_algebra/detail/derive_soa_overload.hpp"
+#include "rigid_geometric_algebra/detail/geometric_operator.hpp"
+#include "rigid_geometric_algebra/wedge.hpp"
+#include "rigid_geometric_algebra/weight_contraction.hpp"
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class antiproject_value_fn : public detail::geometric_operator
+{
+public:
+  using detail::geometric_operator::operator();
+
+  template <class T1, class T2>
+  static constexpr auto operator()(const T1& a, const T2& b)
+      -> decltype(wedge(b, weight_contraction(a, b)))
+  {
+    return wedge(b, weight_contraction(a, b));
+  }
+};
+
+class antiproject_fn : public antiproject_value_fn,
+                       public derive_soa_overload<antiproject_value_fn>
+{
+public:
+  using antiproject_value_fn::operator();
+  using derive_soa_overload<antiproject_value_fn>::operator();
+};
+
+}  // namespace detail
+
+/// orthogonal antiprojection
+/// @param a element to antiproject
+/// @param b element antiprojected onto
+///
+/// Returns `wedge(b, weight_contraction(a, b))`, the element parallel to `a`
+/// that contains `b`. Supported geometric type pairs are
+/// * `line` or `plane` onto `point`, returning a `line` or `plane`
+/// * `plane` onto `line`, returning a `plane`
+///
+/// Only blades that may be nonzero are computed.
+///
+/// Batches may be antiprojected with `antiproject(as, bs, out)` or, onto a
+/// single element, with `antiproject(as, b, out)`, where `as`, `bs`, and `out`
+/// are `soa_span`s.
+///
+inline constexpr auto antiproject = detail::antiproject_fn{};
+
+}  // namespace rigid_geometric_algebra
@@ -2,8 +2,9 @@
 
 #include "rigid_geometric_algebra/algebra_type.hpp"
 #include "rigid_geometric_algebra/complement.hpp"
-#include "rigid_geometric_algebra/detail/concat_ranges.hpp"
-#include "rigid_geometric_algebra/detail/counted_sort.hpp"
+#include "rigid_geometric_algebra/detail/derive_soa_overload.hpp"
+#include "rigid_geometric_algebra/detail/dynamic_operator.hpp"
+#include "rigid_geometric_algebra/detail/inversion_count.hpp"
 #include "rigid_geometric_algebra/detail/linear_operator.hpp"
 #include "rigid_geometric_algebra/detail/negate_if_odd.hpp"
 #include "rigid_geometric_algebra/is_blade.hpp"
@@ -34,9 +35,9 @@ public:
       static constexpr auto negate_count =
           std::size_t(detail::blade_complement_negates<right_t, B1>) +
           std::size_t(detail::blade_complement_negates<right_t, B2>) +
-          detail::counted_sort(detail::concat_ranges(
+          detail::inversion_count(
               decltype(right_complement(b1))::dimensions,
-              decltype(right_complement(b2))::dimensions)) +
+              decltype(right_complement(b2))::dimensions) +
           std::size_t(detail::blade_complement_negates<
                       left_t,
                       decltype(right_complement(b1) ^ right_complement(b2))>);
@@ -47,13 +48,27 @@ public:
   }
 };
 
+using antiwedge_value_fn = detail::linear_operator<detail::antiwedge_blade_fn>;
+
+class antiwedge_fn : public antiwedge_value_fn,
+                     public derive_soa_overload<antiwedge_value_fn>,
+                     public dynamic_operator<cayley_product::antiwedge>
+{
+public:
+  using antiwedge_value_fn::operator();
+  using derive_soa_overload<antiwedge_value_fn>::operator();
+  using dynamic_operator<cayley_product::antiwedge>::operator();
+};
+
 }  // namespace detail
 
 /// antiwedge product
 ///
+/// Batches may be combined with `antiwedge(as, bs, out)`, where `as`, `bs`,
+/// and `out` are `soa_span`s.
+///
 /// @see eq. 2.25
 ///
-inline constexpr auto antiwedge =
-    detail::linear_operator<detail::antiwedge_blade_fn>{};
+inline constexpr auto antiwedge = detail::antiwedge_fn{};
 
 }  // namespace rigid_geometric_algebra
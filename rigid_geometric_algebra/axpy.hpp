@@ -0,0 +1,113 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/detail/fused_multiply_add.hpp"
+#include "rigid_geometric_algebra/detail/multivector_promotable.hpp"
+#include "rigid_geometric_algebra/geometric_fwd.hpp"
+#include "rigid_geometric_algebra/soa_span.hpp"
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class axpy_fn
+{
+public:
+  template <class S, detail::multivector_promotable T>
+    requires std::is_invocable_r_v<
+        T,
+        fused_multiply_add_fn,
+        const S&,
+        const T&,
+        const T&>
+  static constexpr auto operator()(const S& a, const T& x, const T& y) -> T
+  {
+    return fused_multiply_add(a, x, y);
+  }
+
+  template <class S, detail::geometric T>
+    requires std::is_invocable_r_v<
+        typename T::multivector_type,
+        fused_multiply_add_fn,
+        const S&,
+        const typename T::multivector_type&,
+        const typename T::multivector_type&>
+  static constexpr auto operator()(const S& a, const T& x, const T& y) -> T
+  {
+    return T{fused_multiply_add(a, x.multivector(), y.multivector())};
+  }
+
+  /// @pre `xs.size() == ys.size()`
+  ///
+  template <class S, class T1, class T2>
+    requires std::is_same_v<std::remove_const_t<T1>, T2> and
+             std::is_invocable_r_v<
+                 algebra_field_t<algebra_type_t<T2>>,
+                 fused_multiply_add_fn,
+                 const S&,
+                 const algebra_field_t<algebra_type_t<T2>>&,
+                 const algebra_field_t<algebra_type_t<T2>>&>
+  static constexpr auto
+  operator()(const S& a, soa_span<T1> xs, soa_span<T2> ys) -> void
+  {
+    detail::precondition(xs.size() == ys.size());
+
+    for (auto j = 0UZ; j != soa_span<T2>::rank; ++j) {
+      const auto x = xs.column(j);
+      const auto y = ys.column(j);
+
+      for (auto i = 0UZ; i != y.size(); ++i) {
+        y[i] = fused_multiply_add(a, x[i], y[i]);
+      }
+    }
+  }
+
+  /// @pre `xs.size() == ys.size()`
+  ///
+  template <class S, class T1, class T2>
+    requires std::is_same_v<std::remove_const_t<T1>, T2> and
+             std::is_invocable_r_v<T2, axpy_fn, const S&, const T2&, const T2&>
+  static constexpr auto
+  operator()(const S& a, std::span<T1> xs, std::span<T2> ys) -> void
+  {
+    detail::precondition(xs.size() == ys.size());
+
+    for (auto i = 0UZ; i != ys.size(); ++i) {
+      ys[i] = axpy_fn{}(a, xs[i], ys[i]);
+    }
+  }
+};
+
+}  // namespace detail
+
+/// fused scalar multiplication and addition
+/// @param a scalar
+/// @param x, y multivectors, blades, or geometric types of the same type
+///
+/// Returns `a * x + y`, computing each coefficient in a single pass without
+/// materializing `a * x`. Floating-point coefficients are computed with
+/// `std::fma` and are rounded once if the target has a fast `fma`, as
+/// reported by `FP_FAST_FMA` and related macros, and are otherwise computed
+/// with a multiplication and an addition. Other field types use an `fma`
+/// overload found by argument-dependent lookup, if one exists, and otherwise
+/// compute `a * x + y` for each coefficient.
+///
+/// `x` and `y` may also be spans of elements of the same type, in which case
+/// each element of `y` is replaced with `axpy(a, x[i], y[i])`:
+/// ```
+/// axpy(dt, velocities, positions);
+/// ```
+/// If `x` and `y` are `soa_span`s, each coefficient array is updated in turn
+/// and the elements are not constructed.
+///
+/// Multivectors and blades may also be combined with the hidden friend
+/// `fma(a, x, y)`.
+///
+inline constexpr auto axpy = detail::axpy_fn{};
+
+}  // namespace rigid_geometric_algebra
@@ -8,10 +8,10 @@
 #include "rigid_geometric_algebra/canonical_dimension_order.hpp"
 #include "rigid_geometric_algebra/canonical_type.hpp"
 #include "rigid_geometric_algebra/detail/are_dimensions_unique.hpp"
-#include "rigid_geometric_algebra/detail/counted_sort.hpp"
 #include "rigid_geometric_algebra/detail/decays_to.hpp"
 #include "rigid_geometric_algebra/detail/derive_subtraction.hpp"
 #include "rigid_geometric_algebra/detail/derive_vector_space_operations.hpp"
+#include "rigid_geometric_algebra/detail/inversion_count.hpp"
 #include "rigid_geometric_algebra/detail/multivector_sum.hpp"
 #include "rigid_geometric_algebra/detail/negate_if_odd.hpp"
 #include "rigid_geometric_algebra/detail/size_checked_subrange.hpp"
@@ -171,8 +171,8 @@ public:
   constexpr auto canonical(this Self&& self) -> canonical_type
   {
     return canonical_type{detail::negate_if_odd<
-        detail::counted_sort(auto{dimensions}) +
-        detail::counted_sort(auto{canonical_type::dimensions})>{}(
+        detail::inversion_count(dimensions) +
+        detail::inversion_count(canonical_type::dimensions)>{}(
         std::forward<Self>(self).coefficient)};
   }
 
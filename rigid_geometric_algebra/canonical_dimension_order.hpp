@@ -1,8 +1,8 @@
 #pragma once
 
 #include "rigid_geometric_algebra/detail/contract.hpp"
-#include "rigid_geometric_algebra/detail/counted_sort.hpp"
 #include "rigid_geometric_algebra/detail/even.hpp"
+#include "rigid_geometric_algebra/detail/inversion_count.hpp"
 
 #include <algorithm>
 #include <array>
@@ -54,7 +54,7 @@ public:
     // swaps, reverse the bulk part of dimensions (0 remains the first element
     // if present). Otherwise, return dimensions (sorted to be in
     // lexicographic order).
-    if (not detail::even(detail::counted_sort(partitioned))) {
+    if (not detail::even(detail::inversion_count(partitioned))) {
       std::ranges::reverse(bulk);
     }
   }
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/point.hpp"
+#include "rigid_geometric_algebra/soa_span.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class closest_points_fn
+{
+  template <class T>
+  using vector = std::array<T, 3>;
+
+  template <class T>
+  static constexpr auto cross(const vector<T>& a, const vector<T>& b)
+      -> vector<T>
+  {
+    return {
+        a[1] * b[2] - a[2] * b[1],
+        a[2] * b[0] - a[0] * b[2],
+        a[0] * b[1] - a[1] * b[0]};
+  }
+
+  template <class T>
+  static constexpr auto dot(const vector<T>& a, const vector<T>& b) -> T
+  {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+  }
+
+  template <class T>
+  static constexpr auto default_tolerance() -> T
+  {
+    using std::sqrt;
+    return sqrt(std::numeric_limits<T>::epsilon());
+  }
+
+  // coefficients of the closest points `p` and `q` on lines `k` and `l`
+  //
+  // The first half of the coefficients of a line is its direction and the
+  // second half is its moment. With directions `v1`, `v2` and moments `m1`,
+  // `m2`, the common perpendicular has direction `n = v1 x v2`. `p` is the
+  // intersection of `k` with the plane containing `l` and `n`, and
+  // similarly for `q`, so that both have weight `n.n`.
+  //
+  // If the lines are parallel within `tolerance`, `p` is the point on `k`
+  // closest to the origin and `q` is the point on `l` closest to `p`, both
+  // with weight `(v1.v1) (v2.v2)`. Both results are computed and one is
+  // selected so that the function does not branch.
+  template <class T>
+  static constexpr auto solve(
+      const std::array<T, 6>& k,
+      const std::array<T, 6>& l,
+      T tolerance,
+      std::array<T, 4>& p,
+      std::array<T, 4>& q) -> void
+  {
+    const auto v1 = vector<T>{k[0], k[1], k[2]};
+    const auto m1 = vector<T>{k[3], k[4], k[5]};
+    const auto v2 = vector<T>{l[0], l[1], l[2]};
+    const auto m2 = vector<T>{l[3], l[4], l[5]};
+
+    const auto n = cross(v1, v2);
+    const auto a = dot(v1, v1);
+    const auto b = dot(v2, v2);
+    const auto c = dot(n, n);
+
+    const auto parallel = c <= tolerance * tolerance * a * b;
+
+    const auto s1 = cross(cross(v2, n), m1);
+    const auto s2 = cross(cross(n, v1), m2);
+    const auto nm1 = dot(n, m1);
+    const auto nm2 = dot(n, m2);
+
+    // closest point to the origin on `k` and on `l`, scaled by `a` and `b`
+    const auto r1 = cross(v1, m1);
+    const auto r2 = cross(v2, m2);
+    const auto vr = dot(v2, r1);
+
+    p[0] = parallel ? a * b : c;
+    q[0] = p[0];
+    for (auto i = 0UZ; i != 3; ++i) {
+      p[i + 1] = parallel ? b * r1[i] : s1[i] + nm2 * v1[i];
+      q[i + 1] = parallel ? a * r2[i] + vr * v2[i] : s2[i] - nm1 * v2[i];
+    }
+  }
+
+public:
+  template <class A>
+    requires (algebra_dimension_v<A> == 4) and
+             std::floating_point<algebra_field_t<A>>
+  static constexpr auto operator()(
+      const line<A>& k,
+      const line<A>& l,
+      std::type_identity_t<algebra_field_t<A>> tolerance =
+          default_tolerance<algebra_field_t<A>>())
+      -> std::pair<point<A>, point<A>>
+  {
+    using T = algebra_field_t<A>;
+
+    auto kc = std::array<T, 6>{};
+    auto lc = std::array<T, 6>{};
+    std::ranges::copy(k, kc.begin());
+    std::ranges::copy(l, lc.begin());
+
+    auto p = std::array<T, 4>{};
+    auto q = std::array<T, 4>{};
+    solve(kc, lc, tolerance, p, q);
+
+    return {
+        point<A>{p[0], p[1], p[2], p[3]}, point<A>{q[0], q[1], q[2], q[3]}};
+  }
+
+  template <class K, class L>
+    requires std::same_as<
+                 std::remove_const_t<K>,
+                 line<algebra_type_t<K>>> and
+             std::same_as<
+                 std::remove_const_t<L>,
+                 line<algebra_type_t<K>>> and
+             (algebra_dimension_v<algebra_type_t<K>> == 4) and
+             std::floating_point<algebra_field_t<algebra_type_t<K>>>
+  static constexpr auto operator()(
+      soa_span<K> ks,
+      soa_span<L> ls,
+      soa_span<point<algebra_type_t<K>>> ps,
+      soa_span<point<algebra_type_t<K>>> qs,
+      algebra_field_t<algebra_type_t<K>> tolerance =
+          default_tolerance<algebra_field_t<algebra_type_t<K>>>()) -> void
+  {
+    using T = algebra_field_t<algebra_type_t<K>>;
+
+    detail::precondition(
+        ks.size() == ls.size() and ks.size() == ps.size() and
+            ks.size() == qs.size(),
+        [n = ks.size()] {
+          return detail::contract_violation_handler{
+              "each `soa_span` must have size '{}'", n};
+        });
+
+    const auto k = ks.data();
+    const auto l = ls.data();
+    const auto p = ps.data();
+    const auto q = qs.data();
+
+    for (auto i = 0UZ; i != ps.size(); ++i) {
+      auto pc = std::array<T, 4>{};
+      auto qc = std::array<T, 4>{};
+      solve(
+          std::array{k[0][i], k[1][i], k[2][i], k[3][i], k[4][i], k[5][i]},
+          std::array{l[0][i], l[1][i], l[2][i], l[3][i], l[4][i], l[5][i]},
+          tolerance,
+          pc,
+          qc);
+
+      for (auto j = 0UZ; j != 4; ++j) {
+        p[j][i] = pc[j];
+        q[j][i] = qc[j];
+      }
+    }
+  }
+};
+
+}  // namespace detail
+
+/// closest points between two lines
+/// @param k, l lines
+/// @param tolerance sine of the angle between `k` and `l` below which the
+///   lines are treated as parallel
+///
+/// Returns a pair of points `(p, q)`, where `p` lies on `k`, `q` lies on `l`,
+/// and `p - q` is along the common perpendicular of `k` and `l`. The lines
+/// need not be unitized and the points are not unitized. Each point has
+/// weight equal to the squared norm of the cross product of the directions
+/// of `k` and `l`.
+///
+/// If the lines are parallel within `tolerance`, the common perpendicular is
+/// not unique. Then `p` is the point on `k` closest to the origin and `q` is
+/// the point on `l` closest to `p`, and each point has weight equal to the
+/// product of the squared weight norms of `k` and `l`.
+///
+/// Batches may be evaluated with `closest_points(ks, ls, ps, qs)`, where
+/// `ks`, `ls`, `ps`, and `qs` are `soa_span`s and `ps[i]` and `qs[i]` are
+/// the closest points of `ks[i]` and `ls[i]`. Each pair of lines is solved
+/// from the direction and moment coefficients without branching, and the
+/// coefficients of the points are stored to separate arrays.
+///
+/// @pre for batches, each `soa_span` has the same size
+///
+inline constexpr auto closest_points = detail::closest_points_fn{};
+
+}  // namespace rigid_geometric_algebra
@@ -1,9 +1,8 @@
 #pragma once
 
 #include "rigid_geometric_algebra/blade_complement_type.hpp"
-#include "rigid_geometric_algebra/detail/concat_ranges.hpp"
-#include "rigid_geometric_algebra/detail/counted_sort.hpp"
 #include "rigid_geometric_algebra/detail/even.hpp"
+#include "rigid_geometric_algebra/detail/inversion_count.hpp"
 #include "rigid_geometric_algebra/detail/linear_operator.hpp"
 #include "rigid_geometric_algebra/detail/negate_if_odd.hpp"
 #include "rigid_geometric_algebra/is_blade.hpp"
@@ -57,8 +56,7 @@ public:
       std::swap(left, right);
     }
 
-    const auto num_swaps =
-        detail::counted_sort(detail::concat_ranges(left, right));
+    const auto num_swaps = detail::inversion_count(left, right);
     return not detail::even(num_swaps);
   }
 };
@@ -0,0 +1,585 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/antiwedge.hpp"
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/norm.hpp"
+#include "rigid_geometric_algebra/plane.hpp"
+#include "rigid_geometric_algebra/point.hpp"
+#include "rigid_geometric_algebra/wedge.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class convex_hull_fn;
+class halfspace_intersection_fn;
+
+}  // namespace detail
+
+/// reusable storage for `convex_hull` and `halfspace_intersection`
+/// @tparam A algebra type
+///
+/// Holds the faces of the hull under construction, the outside set of each
+/// face, and the results of the last call. Buffers grow as needed and keep
+/// their capacity between calls, so that repeated calls with a similar
+/// number of elements do not allocate.
+///
+/// Results refer to storage owned by the workspace and are invalidated by
+/// the next call using the workspace.
+///
+template <class A>
+  requires (algebra_dimension_v<A> == 4) and
+           std::floating_point<algebra_field_t<A>>
+class convex_hull_workspace
+{
+  friend class detail::convex_hull_fn;
+  friend class detail::halfspace_intersection_fn;
+
+  using value_type = algebra_field_t<A>;
+
+  static constexpr auto none = std::numeric_limits<std::size_t>::max();
+
+  struct face
+  {
+    std::array<std::size_t, 3> vertices{};
+    // face adjacent across edge `i`, from `vertices[i]` to
+    // `vertices[(i + 1) % 3]`, and the index of the shared edge in that face
+    std::array<std::size_t, 3> neighbors{};
+    std::array<std::size_t, 3> neighbor_edges{};
+    plane<A> boundary{};
+    value_type inverse_norm{};
+    // first point of the outside set, linked through `next_`
+    std::size_t outside{none};
+    std::size_t furthest{none};
+    value_type furthest_distance{};
+    // set for faces removed from the hull
+    bool visible{};
+  };
+
+  // face and edges remaining to be crossed in the horizon search
+  struct frame
+  {
+    std::size_t index;
+    std::size_t edge;
+    std::size_t remaining;
+  };
+
+  std::span<const point<A>> points_;
+  value_type tolerance_{};
+
+  std::vector<face> faces_;
+  std::vector<std::size_t> free_faces_;
+  std::vector<value_type> inverse_weights_;
+  std::vector<std::size_t> next_;
+  std::vector<std::size_t> pending_;
+  std::vector<std::size_t> visible_;
+  std::vector<std::pair<std::size_t, std::size_t>> horizon_;
+  std::vector<frame> stack_;
+  std::vector<std::size_t> new_faces_;
+
+  std::vector<plane<A>> planes_;
+  std::vector<std::array<std::size_t, 3>> triangles_;
+  std::vector<point<A>> dual_points_;
+  std::vector<point<A>> vertices_;
+
+  // sign of `side(g, p)` is positive if `p` is on the side of `g` that its
+  // normal points toward
+  static auto side(const plane<A>& g, const point<A>& p) -> value_type
+  {
+    return antiwedge(g.multivector(), p.multivector())
+        .template get<0>()
+        .coefficient;
+  }
+
+  // signed Euclidean distance from the plane of face `f` to point `i`
+  [[nodiscard]]
+  auto distance(std::size_t f, std::size_t i) const -> value_type
+  {
+    return side(faces_[f].boundary, points_[i]) * faces_[f].inverse_norm *
+           inverse_weights_[i];
+  }
+
+  auto make_face(std::size_t a, std::size_t b, std::size_t c) -> std::size_t
+  {
+    auto f = face{};
+    f.vertices = {a, b, c};
+    f.boundary = wedge(wedge(points_[a], points_[b]), points_[c]);
+    f.inverse_norm = value_type{1} / weight_norm(f.boundary);
+
+    if (free_faces_.empty()) {
+      faces_.push_back(f);
+      return faces_.size() - 1;
+    }
+
+    const auto index = free_faces_.back();
+    free_faces_.pop_back();
+    faces_[index] = f;
+    return index;
+  }
+
+  auto link(std::size_t f, std::size_t i, std::size_t g, std::size_t j)
+      -> void
+  {
+    faces_[f].neighbors[i] = g;
+    faces_[f].neighbor_edges[i] = j;
+    faces_[g].neighbors[j] = f;
+    faces_[g].neighbor_edges[j] = i;
+  }
+
+  // adds point `i` to the outside set of the face in `candidates` that it
+  // is furthest above, if any
+  auto assign(std::size_t i, std::span<const std::size_t> candidates) -> void
+  {
+    auto best = none;
+    auto best_distance = tolerance_;
+
+    for (const auto f : candidates) {
+      const auto d = distance(f, i);
+      if (d > best_distance) {
+        best = f;
+        best_distance = d;
+      }
+    }
+
+    if (best == none) {
+      return;
+    }
+
+    auto& f = faces_[best];
+    if (f.outside == none) {
+      pending_.push_back(best);
+    }
+    next_[i] = f.outside;
+    f.outside = i;
+
+    if (f.furthest == none or best_distance > f.furthest_distance) {
+      f.furthest = i;
+      f.furthest_distance = best_distance;
+    }
+  }
+
+  // initial tetrahedron, or `false` if the points do not span a volume
+  auto make_simplex() -> bool
+  {
+    const auto n = points_.size();
+
+    // points with least and greatest coordinates along each axis
+    auto extremes = std::array<std::size_t, 6>{};
+    auto extent = std::array<value_type, 3>{};
+
+    const auto coordinate = [this](std::size_t i, std::size_t j) {
+      return points_[i][j + 1] * inverse_weights_[i];
+    };
+
+    for (auto i = 0UZ; i != n; ++i) {
+      for (auto j = 0UZ; j != 3; ++j) {
+        const auto x = coordinate(i, j);
+        extent[j] = std::max(extent[j], std::abs(x));
+
+        if (x < coordinate(extremes[2 * j], j)) {
+          extremes[2 * j] = i;
+        }
+        if (x > coordinate(extremes[2 * j + 1], j)) {
+          extremes[2 * j + 1] = i;
+        }
+      }
+    }
+
+    tolerance_ = value_type{3} * std::numeric_limits<value_type>::epsilon() *
+                 (extent[0] + extent[1] + extent[2]);
+
+    // most distant pair of extreme points
+    auto a = 0UZ;
+    auto b = 0UZ;
+    auto best = value_type{};
+    for (const auto i : extremes) {
+      for (const auto j : extremes) {
+        auto d = value_type{};
+        for (auto k = 0UZ; k != 3; ++k) {
+          const auto dx = coordinate(i, k) - coordinate(j, k);
+          d += dx * dx;
+        }
+        if (d > best) {
+          a = i;
+          b = j;
+          best = d;
+        }
+      }
+    }
+
+    if (std::sqrt(best) <= tolerance_) {
+      return false;
+    }
+
+    // point furthest from the line through `a` and `b`
+    const auto l = wedge(points_[a], points_[b]);
+    const auto line_norm = weight_norm(l);
+
+    auto c = 0UZ;
+    best = value_type{};
+    for (auto i = 0UZ; i != n; ++i) {
+      const auto d =
+          weight_norm(wedge(l, points_[i])) * inverse_weights_[i] / line_norm;
+      if (d > best) {
+        c = i;
+        best = d;
+      }
+    }
+
+    if (best <= tolerance_) {
+      return false;
+    }
+
+    // point furthest from the plane through `a`, `b`, and `c`
+    const auto g = wedge(l, points_[c]);
+    const auto plane_norm = weight_norm(g);
+
+    auto d = 0UZ;
+    best = value_type{};
+    for (auto i = 0UZ; i != n; ++i) {
+      const auto e = std::abs(side(g, points_[i])) * inverse_weights_[i] /
+                     plane_norm;
+      if (e > best) {
+        d = i;
+        best = e;
+      }
+    }
+
+    if (best <= tolerance_) {
+      return false;
+    }
+
+    // orient faces so that the normals point away from the hull
+    if (side(g, points_[d]) > value_type{}) {
+      std::swap(b, c);
+    }
+
+    const auto f0 = make_face(a, b, c);
+    const auto f1 = make_face(a, d, b);
+    const auto f2 = make_face(b, d, c);
+    const auto f3 = make_face(c, d, a);
+
+    link(f0, 0, f1, 2);
+    link(f0, 1, f2, 2);
+    link(f0, 2, f3, 2);
+    link(f1, 0, f3, 1);
+    link(f1, 1, f2, 0);
+    link(f2, 1, f3, 0);
+
+    const auto simplex = std::array{f0, f1, f2, f3};
+    for (auto i = 0UZ; i != n; ++i) {
+      if (i != a and i != b and i != c and i != d) {
+        assign(i, simplex);
+      }
+    }
+
+    return true;
+  }
+
+  // marks the faces visible from point `eye`, starting from face `f`, and
+  // stores the edges bounding them in counterclockwise order
+  auto find_horizon(std::size_t f, std::size_t eye) -> void
+  {
+    visible_.clear();
+    horizon_.clear();
+    stack_.clear();
+
+    faces_[f].visible = true;
+    visible_.push_back(f);
+    stack_.push_back({.index = f, .edge = 0, .remaining = 3});
+
+    while (not stack_.empty()) {
+      auto& top = stack_.back();
+      if (top.remaining == 0) {
+        stack_.pop_back();
+        continue;
+      }
+
+      const auto current = top.index;
+      const auto i = top.edge;
+      top.edge = (top.edge + 1) % 3;
+      --top.remaining;
+
+      const auto g = faces_[current].neighbors[i];
+      if (faces_[g].visible) {
+        continue;
+      }
+
+      if (distance(g, eye) > tolerance_) {
+        faces_[g].visible = true;
+        visible_.push_back(g);
+
+        // continue with the edges after the one just crossed
+        stack_.push_back(
+            {.index = g,
+             .edge = (faces_[current].neighbor_edges[i] + 1) % 3,
+             .remaining = 2});
+      } else {
+        horizon_.emplace_back(current, i);
+      }
+    }
+  }
+
+  // adds point `eye` to the hull, replacing the faces visible from it
+  auto add_point(std::size_t f, std::size_t eye) -> void
+  {
+    find_horizon(f, eye);
+
+    new_faces_.clear();
+    for (const auto& [h, i] : horizon_) {
+      const auto u = faces_[h].vertices[i];
+      const auto v = faces_[h].vertices[(i + 1) % 3];
+      const auto opposite = faces_[h].neighbors[i];
+      const auto opposite_edge = faces_[h].neighbor_edges[i];
+
+      const auto g = make_face(u, v, eye);
+      link(g, 0, opposite, opposite_edge);
+      new_faces_.push_back(g);
+    }
+
+    const auto m = new_faces_.size();
+    for (auto k = 0UZ; k != m; ++k) {
+      link(new_faces_[k], 1, new_faces_[(k + 1) % m], 2);
+    }
+
+    for (const auto v : visible_) {
+      for (auto i = std::exchange(faces_[v].outside, none); i != none;) {
+        const auto next = next_[i];
+        if (i != eye) {
+          assign(i, new_faces_);
+        }
+        i = next;
+      }
+    }
+
+    free_faces_.insert(free_faces_.end(), visible_.begin(), visible_.end());
+  }
+
+  auto build(std::span<const point<A>> points) -> void
+  {
+    points_ = points;
+
+    faces_.clear();
+    free_faces_.clear();
+    pending_.clear();
+    planes_.clear();
+    triangles_.clear();
+
+    const auto n = points.size();
+
+    inverse_weights_.resize(n);
+    next_.assign(n, none);
+
+    for (auto i = 0UZ; i != n; ++i) {
+      detail::precondition(points[i][0] > value_type{}, [i] {
+        return detail::contract_violation_handler{
+            "point '{}' must have a positive weight", i};
+      });
+      inverse_weights_[i] = value_type{1} / points[i][0];
+    }
+
+    if (n >= 4 and make_simplex()) {
+      while (not pending_.empty()) {
+        const auto f = pending_.back();
+        pending_.pop_back();
+
+        if (not faces_[f].visible and faces_[f].outside != none) {
+          add_point(f, faces_[f].furthest);
+        }
+      }
+
+      for (const auto& f : faces_) {
+        if (not f.visible) {
+          planes_.push_back(f.boundary);
+          triangles_.push_back(f.vertices);
+        }
+      }
+    }
+
+    points_ = {};
+  }
+
+public:
+  /// constructs an empty workspace
+  ///
+  convex_hull_workspace() = default;
+
+  /// constructs a workspace with storage for a number of elements
+  /// @param count number of points or planes
+  ///
+  explicit convex_hull_workspace(std::size_t count)
+  {
+    // a hull of `n` points has at most `2n - 4` faces
+    const auto faces = 2 * count;
+
+    faces_.reserve(faces);
+    free_faces_.reserve(faces);
+    inverse_weights_.reserve(count);
+    next_.reserve(count);
+    pending_.reserve(faces);
+    planes_.reserve(faces);
+    triangles_.reserve(faces);
+    dual_points_.reserve(count);
+    vertices_.reserve(faces);
+  }
+
+  /// face planes of the last hull
+  ///
+  /// Normals point away from the hull.
+  ///
+  [[nodiscard]]
+  auto planes() const noexcept -> std::span<const plane<A>>
+  {
+    return planes_;
+  }
+
+  /// vertex indices of the faces of the last hull
+  ///
+  /// The `i`-th element holds the indices of the input elements forming
+  /// `planes()[i]`, counterclockwise when viewed from outside the hull.
+  ///
+  [[nodiscard]]
+  auto triangles() const noexcept
+      -> std::span<const std::array<std::size_t, 3>>
+  {
+    return triangles_;
+  }
+
+  /// vertices of the last half-space intersection
+  ///
+  [[nodiscard]]
+  auto vertices() const noexcept -> std::span<const point<A>>
+  {
+    return vertices_;
+  }
+};
+
+namespace detail {
+
+class convex_hull_fn
+{
+public:
+  template <class A>
+  static auto operator()(
+      std::span<const point<std::type_identity_t<A>>> points,
+      convex_hull_workspace<A>& workspace) -> std::span<const plane<A>>
+  {
+    workspace.build(points);
+    return workspace.planes();
+  }
+};
+
+class halfspace_intersection_fn
+{
+public:
+  template <class A>
+  static auto operator()(
+      std::span<const plane<std::type_identity_t<A>>> planes,
+      const point<std::type_identity_t<A>>& interior,
+      convex_hull_workspace<A>& workspace) -> std::span<const point<A>>
+  {
+    using T = algebra_field_t<A>;
+    using W = convex_hull_workspace<A>;
+
+    detail::precondition(interior[0] > T{}, [] {
+      return detail::contract_violation_handler{
+          "interior point must have a positive weight"};
+    });
+
+    // dual point of each half-space relative to `interior`, at the
+    // Euclidean position `n / -s` for a half-space with normal `n` and
+    // signed distance `s` of the interior point, scaled by the weight of
+    // the interior point
+    workspace.dual_points_.clear();
+    for (auto i = 0UZ; i != planes.size(); ++i) {
+      const auto& g = planes[i];
+      const auto s = W::side(g, interior);
+
+      detail::precondition(s < T{}, [i] {
+        return detail::contract_violation_handler{
+            "interior point must lie strictly inside half-space '{}'", i};
+      });
+
+      const auto w = interior[0];
+      workspace.dual_points_.push_back(
+          point<A>{-s, g[0] * w, g[1] * w, g[2] * w});
+    }
+
+    workspace.build(workspace.dual_points_);
+
+    // each face of the dual hull is a vertex of the intersection, where the
+    // planes of its three vertices meet
+    workspace.vertices_.clear();
+    for (const auto& [i, j, k] : workspace.triangles_) {
+      auto p = point<A>{antiwedge(
+          antiwedge(planes[i].multivector(), planes[j].multivector()),
+          planes[k].multivector())};
+
+      if (p[0] < T{}) {
+        p = point<A>{-p.multivector()};
+      }
+      workspace.vertices_.push_back(p);
+    }
+
+    return workspace.vertices();
+  }
+};
+
+}  // namespace detail
+
+/// convex hull of a set of points
+/// @param points points with positive weight
+/// @param workspace storage reused between calls
+///
+/// Computes the convex hull with the quickhull algorithm and returns the
+/// planes of its triangular faces, with normals pointing away from the
+/// hull. Each face plane is the `wedge` of its three vertices, whose indices
+/// are available from `workspace.triangles()`.
+///
+/// Points within a small tolerance of a face, relative to the extent of the
+/// points, are considered to lie on it. Coplanar faces are not merged. If
+/// the points do not span a volume, no faces are returned.
+///
+/// @pre each point has a positive weight
+///
+inline constexpr auto convex_hull = detail::convex_hull_fn{};
+
+/// intersection of a set of half-spaces
+/// @param planes planes bounding each half-space, with normals pointing
+///   away from it
+/// @param interior point strictly inside each half-space
+/// @param workspace storage reused between calls
+///
+/// Returns the vertices of the convex polytope where `antiwedge(g, p)` is
+/// not positive for each plane `g`. Each half-space is mapped to a dual
+/// point relative to `interior` and each face of the convex hull of the dual
+/// points corresponds to a vertex of the intersection, computed as the
+/// `antiwedge` of the three planes meeting there. The vertices are scaled to
+/// have positive weight.
+///
+/// The `i`-th vertex lies on the planes with indices
+/// `workspace.triangles()[i]`. Redundant half-spaces do not contribute
+/// vertices, and a vertex where more than three planes meet may be
+/// returned more than once.
+///
+/// @pre `interior` has a positive weight
+/// @pre `interior` lies strictly inside each half-space
+/// @pre the intersection is bounded
+///
+inline constexpr auto halfspace_intersection =
+    detail::halfspace_intersection_fn{};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "rigid_geometric_algebra/field.hpp"
+#include "rigid_geometric_algebra/field_identity.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/operation_counts.hpp"
+
+#include <compare>
+#include <format>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace rigid_geometric_algebra {
+
+/// field type that counts arithmetic operations
+/// @tparam T field type
+///
+/// A `counted` value wraps a value of field type `T`. Each arithmetic
+/// operation on `counted<T>` values forwards to `T` and increments a
+/// thread-local counter for that kind of operation. Using `counted<T>` as the
+/// field type of an `algebra` measures the number of operations performed by
+/// an operator:
+/// ```
+/// using A = algebra<counted<double>, 3>;
+///
+/// counted<double>::reset();
+/// wedge(p, q);
+/// const auto ops = counted<double>::counts();
+/// ```
+///
+/// Counters are shared by all `counted<T>` values of the same type `T` on
+/// the same thread. Comparisons are not counted.
+///
+/// `counted` models `field`. The line invariant is not checked for `counted`
+/// values so that constructing a line does not perform any operations.
+///
+template <field T>
+class counted
+{
+  T value_{};
+
+  static thread_local inline auto counts_ = operation_counts{};
+
+public:
+  /// constructs a zero value
+  ///
+  counted() = default;
+
+  /// constructs from a value of the wrapped field type
+  ///
+  constexpr counted(T value) noexcept(std::is_nothrow_move_constructible_v<T>)
+      : value_{std::move(value)}
+  {}
+
+  /// wrapped value
+  ///
+  [[nodiscard]]
+  constexpr auto value() const noexcept -> const T&
+  {
+    return value_;
+  }
+
+  /// operations counted on this thread since the last reset
+  ///
+  [[nodiscard]]
+  static auto counts() noexcept -> const operation_counts&
+  {
+    return counts_;
+  }
+
+  /// resets the counters of this thread
+  ///
+  static auto reset() noexcept -> void { counts_ = {}; }
+
+  /// arithmetic operations
+  ///
+  /// @{
+
+  friend auto operator-(const counted& x) -> counted
+  {
+    ++counts_.negations;
+    return -x.value_;
+  }
+
+  friend auto operator+(const counted& x, const counted& y) -> counted
+  {
+    ++counts_.additions;
+    return x.value_ + y.value_;
+  }
+
+  friend auto operator-(const counted& x, const counted& y) -> counted
+  {
+    ++counts_.subtractions;
+    return x.value_ - y.value_;
+  }
+
+  friend auto operator*(const counted& x, const counted& y) -> counted
+  {
+    ++counts_.multiplications;
+    return x.value_ * y.value_;
+  }
+
+  friend auto operator/(const counted& x, const counted& y) -> counted
+  {
+    ++counts_.divisions;
+    return x.value_ / y.value_;
+  }
+
+  /// @}
+
+  /// comparison
+  ///
+  /// @{
+
+  friend auto operator==(const counted&, const counted&) -> bool = default;
+
+  friend auto operator<=>(const counted& x, const counted& y)
+    requires std::three_way_comparable<T>
+  {
+    return x.value_ <=> y.value_;
+  }
+
+  /// @}
+};
+
+/// field identity value for counted multiplication
+///
+template <class T>
+inline constexpr auto field_identity<counted<T>, std::multiplies<>> =
+    counted<T>{field_identity<T, std::multiplies<>>};
+
+/// disable line invariant checks for counted values
+///
+template <class T>
+inline constexpr auto disable_line_invariant<counted<T>> = true;
+
+}  // namespace rigid_geometric_algebra
+
+template <class T, class Char>
+struct std::formatter<::rigid_geometric_algebra::counted<T>, Char>
+    : std::formatter<T, Char>
+{
+  template <class O>
+  constexpr auto format(
+      const ::rigid_geometric_algebra::counted<T>& x,
+      std::basic_format_context<O, Char>& ctx) const -> O
+  {
+    return std::formatter<T, Char>::format(x.value(), ctx);
+  }
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "rigid_geometric_algebra/detail/copy_ref_qual.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace rigid_geometric_algebra::detail {
+
+/// storage for a sequence of blades
+/// @tparam Bs blade types
+///
+/// Stores blades as consecutive data members in the order of `Bs...`. Unlike
+/// `std::tuple`, whose element order is implementation-defined, the blades
+/// are laid out in the specified order. Each blade is a separate subobject,
+/// so the coefficients do not form an array and must not be accessed through
+/// a pointer to another coefficient.
+///
+/// @{
+
+template <class... Bs>
+class blade_storage
+{
+public:
+  friend auto
+  operator==(const blade_storage&, const blade_storage&) -> bool = default;
+};
+
+template <class B, class... Bs>
+class blade_storage<B, Bs...>
+{
+  B first_{};
+  [[no_unique_address]] blade_storage<Bs...> rest_{};
+
+public:
+  blade_storage() = default;
+
+  template <class T, class... Ts>
+    requires (sizeof...(Ts) == sizeof...(Bs)) and std::constructible_from<B, T>
+  constexpr explicit blade_storage(T&& t, Ts&&... ts)
+      : first_(std::forward<T>(t)), rest_(std::forward<Ts>(ts)...)
+  {}
+
+  /// access the `I`-th blade
+  ///
+  template <std::size_t I, class Self>
+    requires (I <= sizeof...(Bs))
+  constexpr auto get(this Self&& self) -> decltype(auto)
+  {
+    if constexpr (I == 0) {
+      return static_cast<copy_ref_qual_t<Self&&, B>>(self.first_);
+    } else {
+      return std::forward<Self>(self).rest_.template get<I - 1>();
+    }
+  }
+
+  friend auto
+  operator==(const blade_storage&, const blade_storage&) -> bool = default;
+};
+
+/// @}
+
+}  // namespace rigid_geometric_algebra::detail
@@ -0,0 +1,251 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_fwd.hpp"
+#include "rigid_geometric_algebra/blade_ordering.hpp"
+#include "rigid_geometric_algebra/canonical_dimension_order.hpp"
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/detail/dynamic_operator.hpp"
+#include "rigid_geometric_algebra/detail/even.hpp"
+#include "rigid_geometric_algebra/detail/inversion_count.hpp"
+#include "rigid_geometric_algebra/detail/structural_bitset.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace rigid_geometric_algebra::detail {
+
+/// entry of a Cayley table
+///
+struct cayley_entry
+{
+  /// dimension mask of the product blade
+  std::uint8_t mask{};
+
+  /// `1` or `-1`, or `0` if the product is zero
+  std::int8_t sign{};
+};
+
+/// Cayley tables of the canonical blades of an algebra
+///
+/// Blades are identified by their dimension mask. Coefficients refer to the
+/// blade with dimensions in canonical order, as with `blade::canonical_type`.
+///
+struct cayley_tables
+{
+  /// largest supported algebra dimension, limited by `structural_bitset`
+  ///
+  static constexpr auto max_dimension = 8UZ;
+
+  /// algebra dimension
+  ///
+  std::size_t dimension{};
+
+  /// blade masks in canonical blade order, as defined by `blade_ordering`
+  ///
+  std::vector<std::uint8_t> blades;
+
+  /// position of each blade mask in `blades`
+  ///
+  std::vector<std::uint8_t> rank;
+
+  /// product tables, indexed by `(mask1 << dimension) | mask2`
+  ///
+  std::array<std::vector<cayley_entry>, 4> products;
+
+  /// product of the canonical blades with masks `m1` and `m2`
+  ///
+  [[nodiscard]]
+  auto operator()(cayley_product p, std::uint8_t m1, std::uint8_t m2) const
+      -> cayley_entry
+  {
+    return products[static_cast<std::size_t>(p)]
+                   [(std::size_t{m1} << dimension) | m2];
+  }
+};
+
+// builds the Cayley tables of an algebra with dimension `D`
+//
+// Signs are determined with the same steps as the blade overloads of
+// `geometric_product`, `wedge`, `left_complement`, and `right_complement`
+// and their compositions `geometric_antiproduct` and `antiwedge`.
+template <std::size_t D>
+auto make_cayley_tables() -> cayley_tables
+{
+  using A = algebra<double, D - 1>;
+  using mask_type = structural_bitset<D>;
+
+  static constexpr auto n = 1UZ << D;
+  static constexpr auto full = n - 1;
+
+  struct canonical_blade
+  {
+    std::array<std::size_t, D> storage{};
+    std::size_t grade{};
+
+    [[nodiscard]]
+    auto dimensions() const -> std::span<const std::size_t>
+    {
+      return {storage.data(), grade};
+    }
+  };
+
+  auto blades = std::vector<canonical_blade>(n);
+  for (auto m = 0UZ; m != n; ++m) {
+    auto& b = blades[m];
+    for (auto i = 0UZ; i != D; ++i) {
+      if ((m >> i) & 1U) {
+        b.storage[b.grade++] = i;
+      }
+    }
+    canonical_dimension_order<D>(std::span{b.storage.data(), b.grade});
+  }
+
+  // parity of the swaps needed to sort a sequence of dimensions
+  const auto odd = [](const auto&... ranges) {
+    return not even(inversion_count(ranges...));
+  };
+
+  const auto dims = [&blades](std::size_t m) {
+    return blades[m].dimensions();
+  };
+
+  // sign of the complement, see `blade_complement_negates`
+  const auto right_negates = [&](std::size_t m) {
+    return odd(dims(m), dims(full ^ m));
+  };
+  const auto left_negates = [&](std::size_t m) {
+    return odd(dims(full ^ m), dims(m));
+  };
+
+  const auto entry = [](std::size_t mask, std::size_t swaps) {
+    return cayley_entry{
+        static_cast<std::uint8_t>(mask),
+        static_cast<std::int8_t>(even(swaps) ? 1 : -1)};
+  };
+
+  const auto geometric_product =
+      [&](std::size_t m1, std::size_t m2) -> cayley_entry {
+    // the projective dimension squares to zero
+    if ((m1 & m2 & 1U) != 0) {
+      return {};
+    }
+
+    auto swaps = std::size_t(odd(dims(m1))) + std::size_t(odd(dims(m2)));
+    for (auto i : dims(m1)) {
+      for (auto j : dims(m2)) {
+        swaps += std::size_t(i > j);
+      }
+    }
+
+    // repeated factors square to one
+    const auto m = m1 ^ m2;
+    return entry(m, swaps + std::size_t(odd(dims(m))));
+  };
+
+  const auto wedge = [&](std::size_t m1, std::size_t m2) -> cayley_entry {
+    if ((m1 & m2) != 0) {
+      return {};
+    }
+
+    const auto m = m1 | m2;
+    return entry(
+        m, std::size_t(odd(dims(m1), dims(m2))) + std::size_t(odd(dims(m))));
+  };
+
+  const auto geometric_antiproduct =
+      [&](std::size_t m1, std::size_t m2) -> cayley_entry {
+    const auto p = geometric_product(full ^ m1, full ^ m2);
+    if (p.sign == 0) {
+      return {};
+    }
+
+    return entry(
+        full ^ p.mask,
+        std::size_t(right_negates(m1)) + std::size_t(right_negates(m2)) +
+            std::size_t(p.sign < 0) + std::size_t(left_negates(p.mask)));
+  };
+
+  const auto antiwedge = [&](std::size_t m1, std::size_t m2) -> cayley_entry {
+    const auto r1 = full ^ m1;
+    const auto r2 = full ^ m2;
+    if ((r1 & r2) != 0) {
+      return {};
+    }
+
+    return entry(
+        full ^ (r1 | r2),
+        std::size_t(right_negates(m1)) + std::size_t(right_negates(m2)) +
+            std::size_t(odd(dims(r1), dims(r2))) +
+            std::size_t(left_negates(r1 | r2)));
+  };
+
+  auto tables = cayley_tables{};
+  tables.dimension = D;
+
+  tables.blades.resize(n);
+  std::iota(tables.blades.begin(), tables.blades.end(), std::uint8_t{});
+  std::ranges::sort(tables.blades, {}, [](std::uint8_t m) {
+    return blade_ordering<A>{mask_type{m}};
+  });
+
+  tables.rank.resize(n);
+  for (auto r = 0UZ; r != n; ++r) {
+    tables.rank[tables.blades[r]] = static_cast<std::uint8_t>(r);
+  }
+
+  const auto fill = [&tables](cayley_product p, auto f) {
+    auto& table = tables.products[static_cast<std::size_t>(p)];
+    table.resize(n * n);
+    for (auto m1 = 0UZ; m1 != n; ++m1) {
+      for (auto m2 = 0UZ; m2 != n; ++m2) {
+        table[(m1 << D) | m2] = f(m1, m2);
+      }
+    }
+  };
+
+  fill(cayley_product::geometric_product, geometric_product);
+  fill(cayley_product::geometric_antiproduct, geometric_antiproduct);
+  fill(cayley_product::wedge, wedge);
+  fill(cayley_product::antiwedge, antiwedge);
+
+  return tables;
+}
+
+template <std::size_t D>
+auto cached_cayley_tables() -> const cayley_tables&
+{
+  static const auto tables = make_cayley_tables<D>();
+  return tables;
+}
+
+/// obtains the Cayley tables of an algebra
+/// @param dimension algebra dimension
+///
+/// Tables are built on first use and shared by all callers.
+///
+/// @pre `2 <= dimension and dimension <= cayley_tables::max_dimension`
+///
+inline auto cayley_tables_for(std::size_t dimension) -> const cayley_tables&
+{
+  detail::precondition(
+      2 <= dimension and dimension <= cayley_tables::max_dimension,
+      [dimension, max = cayley_tables::max_dimension] {
+        return contract_violation_handler{
+            "algebra dimension '{}' must be in [2, {}]", dimension, max};
+      });
+
+  static constexpr auto cached =
+      []<std::size_t... Is>(std::index_sequence<Is...>) {
+        return std::array{&cached_cayley_tables<Is + 2>...};
+      }(std::make_index_sequence<cayley_tables::max_dimension - 1>{});
+
+  return cached[dimension - 2]();
+}
+
+}  // namespace rigid_geometric_algebra::detail
@@ -8,6 +8,7 @@
 #include <source_location>
 #include <string_view>
 #include <tuple>
+#include <type_traits>
 
 namespace rigid_geometric_algebra::detail {
 
@@ -107,30 +108,75 @@ struct contract_violation_handler : logging_violation_handler<Args...>
   }
 };
 
+/// specifies that `H` is a contract violation handler for `ContractKind`
+///
+template <class H, class ContractKind>
+concept violation_handler_for = std::is_invocable_v<
+    const H&,
+    ContractKind,
+    const std::source_location&>;
+
+/// specifies that `F` lazily constructs a contract violation handler for
+/// `ContractKind`
+///
+/// A lazy handler is a nullary invocable returning a contract violation
+/// handler. It is only invoked if the contract is violated, so message
+/// arguments are only evaluated and captured on failure:
+/// ```
+/// precondition(i < n, [i, n] {
+///   return contract_violation_handler{"index '{}' exceeds '{}'", i, n};
+/// });
+/// ```
+/// The returned handler may refer to the captures of `F` but must not refer to
+/// temporaries created when `F` is invoked.
+///
+template <class F, class ContractKind>
+concept lazy_violation_handler_for =
+    std::is_invocable_v<const F&> and
+    violation_handler_for<std::invoke_result_t<const F&>, ContractKind>;
+
+/// invokes a contract violation handler
+///
+/// Kept out of line and marked cold so that a contract check inlines to a
+/// single, predictable branch on its condition.
+///
+template <class ContractKind, class Handler>
+[[gnu::cold, gnu::noinline]]
+constexpr auto
+violate(const Handler& violation_handler, const std::source_location& sl)
+    -> void
+{
+  if constexpr (violation_handler_for<Handler, ContractKind>) {
+    violation_handler(ContractKind{}, sl);
+  } else {
+    violation_handler()(ContractKind{}, sl);
+  }
+}
+
 /// check a precondition, optionally printing a message on failure
 /// @param cond boolean-convertible value
 /// @param violation_handler handler to invoke on contract violation.
 /// @param sl source location
 ///
 /// Check precondition `cond`. If `false`, invoke `handler(sl)`.
+/// `violation_handler` may also be a lazy handler, see
+/// `lazy_violation_handler_for`.
 ///
 /// @{
 
 template <class Handler>
-  requires std::is_invocable_v<
-      const Handler&,
-      precondition_contract,
-      const std::source_location&>
+  requires violation_handler_for<Handler, precondition_contract> or
+           lazy_violation_handler_for<Handler, precondition_contract>
 constexpr auto precondition(
     const std::convertible_to<bool> auto& cond,
     const Handler& violation_handler,
     const std::source_location& sl = std::source_location::current()) -> void
 {
-  if (cond) {
+  if (cond) [[likely]] {
     return;
   }
 
-  violation_handler(precondition_contract{}, sl);
+  violate<precondition_contract>(violation_handler, sl);
 }
 
 constexpr auto precondition(
@@ -138,7 +184,8 @@ constexpr auto precondition(
     std::format_string<> message = "",  // NOLINT(misc-include-cleaner)
     const std::source_location& sl = std::source_location::current()) -> void
 {
-  return precondition(cond, contract_violation_handler{message}, sl);
+  return precondition(
+      cond, [message] { return contract_violation_handler{message}; }, sl);
 }
 
 /// @}
@@ -149,24 +196,24 @@ constexpr auto precondition(
 /// @param sl source location
 ///
 /// Check invariant `cond`. If `false`, invoke `handler(sl)`.
+/// `violation_handler` may also be a lazy handler, see
+/// `lazy_violation_handler_for`.
 ///
 /// @{
 
 template <class Handler>
-  requires std::is_invocable_v<
-      const Handler&,
-      invariant_contract,
-      const std::source_location&>
+  requires violation_handler_for<Handler, invariant_contract> or
+           lazy_violation_handler_for<Handler, invariant_contract>
 constexpr auto invariant(
     const std::convertible_to<bool> auto& cond,
     const Handler& violation_handler,
     const std::source_location& sl = std::source_location::current()) -> void
 {
-  if (cond) {
+  if (cond) [[likely]] {
     return;
   }
 
-  violation_handler(invariant_contract{}, sl);
+  violate<invariant_contract>(violation_handler, sl);
 }
 
 constexpr auto invariant(
@@ -174,7 +221,8 @@ constexpr auto invariant(
     std::format_string<> message = "",  // NOLINT(misc-include-cleaner)
     const std::source_location& sl = std::source_location::current()) -> void
 {
-  return invariant(cond, contract_violation_handler{message}, sl);
+  return invariant(
+      cond, [message] { return contract_violation_handler{message}; }, sl);
 }
 
 /// check a postcondition, optionally printing a message on failure
@@ -183,24 +231,24 @@ constexpr auto invariant(
 /// @param sl source location
 ///
 /// Check postcondition `cond`. If `false`, invoke `handler(sl)`.
+/// `violation_handler` may also be a lazy handler, see
+/// `lazy_violation_handler_for`.
 ///
 /// @{
 
 template <class Handler>
-  requires std::is_invocable_v<
-      const Handler&,
-      postcondition_contract,
-      const std::source_location&>
+  requires violation_handler_for<Handler, postcondition_contract> or
+           lazy_violation_handler_for<Handler, postcondition_contract>
 constexpr auto postcondition(
     const std::convertible_to<bool> auto& cond,
     const Handler& violation_handler,
     const std::source_location& sl = std::source_location::current()) -> void
 {
-  if (cond) {
+  if (cond) [[likely]] {
     return;
   }
 
-  violation_handler(postcondition_contract{}, sl);
+  violate<postcondition_contract>(violation_handler, sl);
 }
 
 constexpr auto postcondition(
@@ -208,7 +256,8 @@ constexpr auto postcondition(
     std::format_string<> message = "",  // NOLINT(misc-include-cleaner)
     const std::source_location& sl = std::source_location::current()) -> void
 {
-  return postcondition(cond, contract_violation_handler{message}, sl);
+  return postcondition(
+      cond, [message] { return contract_violation_handler{message}; }, sl);
 }
 
 /// @}
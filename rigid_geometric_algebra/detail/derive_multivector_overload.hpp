@@ -33,7 +33,30 @@ class derive_multivector_overload
       detail::is_complete_v<F>,
       "`F` must be complete - this is not intended as a CRTP base class.");
 
+  // blades for which `F` is not invocable are kept so that substitution fails
+  static constexpr auto is_non_zero_constant_unary_result = []<class B> {
+    if constexpr (std::is_invocable_v<F, B>) {
+      using R = std::invoke_result_t<F, B>;
+      return not detail::is_specialization_of<R, zero_constant>{};
+    } else {
+      return true;
+    }
+  };
+
+  template <class V>
+  using blade_list_t = detail::type_filter_t<
+      typename std::remove_cvref_t<V>::blade_list_type,
+      is_non_zero_constant_unary_result>;
+
+  template <template <class...> class list, class V>
+  static constexpr auto
+  impl(list<>, const V&) -> zero_constant<algebra_type_t<V>>
+  {
+    return {};
+  }
+
   template <template <class...> class list, class... Bs, class V>
+    requires (sizeof...(Bs) != 0)
   static constexpr auto impl(list<Bs...>, V&& v)
       -> multivector_type_from_blade_list_t<sorted_canonical_blades_t<
           std::invoke_result_t<F, detail::copy_ref_qual_t<V&&, Bs>>...>>
@@ -90,11 +113,10 @@ class derive_multivector_overload
 
 public:
   template <detail::multivector V>
-  static constexpr auto operator()(V&& v) -> decltype(impl(
-      typename std::remove_cvref_t<V>::blade_list_type{}, std::forward<V>(v)))
+  static constexpr auto operator()(V&& v)
+      -> decltype(impl(blade_list_t<V>{}, std::forward<V>(v)))
   {
-    return impl(
-        typename std::remove_cvref_t<V>::blade_list_type{}, std::forward<V>(v));
+    return impl(blade_list_t<V>{}, std::forward<V>(v));
   }
 
   template <
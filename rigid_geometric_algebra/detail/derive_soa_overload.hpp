@@ -0,0 +1,106 @@
+#pragma once
+
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/detail/is_complete.hpp"
+#include "rigid_geometric_algebra/soa_span.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace rigid_geometric_algebra::detail {
+
+/// helper type that synthesizes overloads for `soa_span` arguments
+/// @tparam F function object defining overloads for single values
+///
+/// Provides overloads taking input `soa_span`s followed by an output
+/// `soa_span`. The `i`-th element of the output is assigned the result of
+/// invoking `F` with the `i`-th element of each input. Either of two inputs
+/// may instead be a single value used for every element.
+///
+template <class F>
+class derive_soa_overload
+{
+  static_assert(
+      detail::is_complete_v<F>,
+      "`F` must be complete - this is not intended as a CRTP base class.");
+
+public:
+  /// @pre `in.size() == out.size()`
+  ///
+  template <class T, class R>
+    requires (not std::is_const_v<R>) and
+             std::is_invocable_r_v<R, F, typename soa_span<T>::value_type>
+  static constexpr auto operator()(soa_span<T> in, soa_span<R> out) -> void
+  {
+    detail::precondition(in.size() == out.size());
+
+    for (auto i = 0UZ; i != out.size(); ++i) {
+      out.store(i, F{}(in[i]));
+    }
+  }
+
+  /// @pre `in1.size() == out.size()`
+  /// @pre `in2.size() == out.size()`
+  ///
+  template <class T1, class T2, class R>
+    requires (not std::is_const_v<R>) and
+             std::is_invocable_r_v<
+                 R,
+                 F,
+                 typename soa_span<T1>::value_type,
+                 typename soa_span<T2>::value_type>
+  static constexpr auto
+  operator()(soa_span<T1> in1, soa_span<T2> in2, soa_span<R> out) -> void
+  {
+    detail::precondition(in1.size() == out.size());
+    detail::precondition(in2.size() == out.size());
+
+    for (auto i = 0UZ; i != out.size(); ++i) {
+      out.store(i, F{}(in1[i], in2[i]));
+    }
+  }
+
+  /// invokes `F` with each element of `in1` and the same value `x2`
+  ///
+  /// @pre `in1.size() == out.size()`
+  ///
+  template <class T1, class U2, class R>
+    requires (not std::is_const_v<R>) and
+             std::is_invocable_r_v<
+                 R,
+                 F,
+                 typename soa_span<T1>::value_type,
+                 const U2&>
+  static constexpr auto
+  operator()(soa_span<T1> in1, const U2& x2, soa_span<R> out) -> void
+  {
+    detail::precondition(in1.size() == out.size());
+
+    for (auto i = 0UZ; i != out.size(); ++i) {
+      out.store(i, F{}(in1[i], x2));
+    }
+  }
+
+  /// invokes `F` with the same value `x1` and each element of `in2`
+  ///
+  /// @pre `in2.size() == out.size()`
+  ///
+  template <class U1, class T2, class R>
+    requires (not std::is_const_v<R>) and
+             std::is_invocable_r_v<
+                 R,
+                 F,
+                 const U1&,
+                 typename soa_span<T2>::value_type>
+  static constexpr auto
+  operator()(const U1& x1, soa_span<T2> in2, soa_span<R> out) -> void
+  {
+    detail::precondition(in2.size() == out.size());
+
+    for (auto i = 0UZ; i != out.size(); ++i) {
+      out.store(i, F{}(x1, in2[i]));
+    }
+  }
+};
+
+}  // namespace rigid_geometric_algebra::detail
@@ -2,6 +2,7 @@
 
 #include "rigid_geometric_algebra/detail/decays_to.hpp"
 #include "rigid_geometric_algebra/detail/define_prioritized_overload.hpp"
+#include "rigid_geometric_algebra/detail/fused_multiply_add.hpp"
 #include "rigid_geometric_algebra/detail/invoke_prioritized_overload.hpp"
 #include "rigid_geometric_algebra/detail/overload.hpp"
 #include "rigid_geometric_algebra/detail/priority_list.hpp"
@@ -25,6 +26,7 @@ namespace rigid_geometric_algebra::detail {
 /// -: D x D -> D (subtraction)
 /// +: D x D -> D (addition)
 /// *: S x D -> D (scalar multiplication)
+/// fma: S x D x D -> D (fused scalar multiplication and addition)
 ///
 /// for derived type D and scalar type S.
 ///
@@ -85,6 +87,27 @@ public:
     return D{(s * F{}(std::forward<T2>(t2)))...};
   }
 
+  /// fused scalar multiplication and addition
+  ///
+  /// computes `s * t2 + t3` in a single pass over the components, without
+  /// materializing `s * t2`. Floating-point components are computed with
+  /// `std::fma` if the target has a fast `fma`.
+  ///
+  template <class S, detail::decays_to<D> T2, detail::decays_to<D> T3>
+    requires ((
+        std::is_invocable_r_v<
+            std::remove_cvref_t<std::invoke_result_t<F, T3>>,
+            fused_multiply_add_fn,
+            const S&,
+            std::invoke_result_t<F, T2>,
+            std::invoke_result_t<F, T3>> and
+        ...))
+  friend constexpr auto fma(const S& s, T2&& t2, T3&& t3) -> D
+  {
+    return D{fused_multiply_add(
+        s, F{}(std::forward<T2>(t2)), F{}(std::forward<T3>(t3)))...};
+  }
+
   /// equality comparison
   ///
   /// defined to allow default definition for derived types
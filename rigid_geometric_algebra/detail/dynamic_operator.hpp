@@ -0,0 +1,47 @@
+#pragma once
+
+#include "rigid_geometric_algebra/dynamic_multivector_fwd.hpp"
+#include "rigid_geometric_algebra/sparse_multivector_fwd.hpp"
+
+#include <cstddef>
+
+namespace rigid_geometric_algebra::detail {
+
+/// products with a runtime Cayley table
+///
+enum class cayley_product : std::size_t
+{
+  geometric_product,
+  geometric_antiproduct,
+  wedge,
+  antiwedge,
+};
+
+/// defines `dynamic_multivector` and `sparse_multivector` overloads for a
+/// product
+/// @tparam P product
+///
+template <cayley_product P>
+class dynamic_operator
+{
+public:
+  /// @pre `x.dimension() == y.dimension()`
+  ///
+  template <class T>
+  static auto
+  operator()(const dynamic_multivector<T>& x, const dynamic_multivector<T>& y)
+      -> dynamic_multivector<T>
+  {
+    return dynamic_multivector<T>::template product<P>(x, y);
+  }
+
+  template <class A>
+  static auto
+  operator()(const sparse_multivector<A>& x, const sparse_multivector<A>& y)
+      -> sparse_multivector<A>
+  {
+    return sparse_multivector<A>::template product<P>(x, y);
+  }
+};
+
+}  // namespace rigid_geometric_algebra::detail
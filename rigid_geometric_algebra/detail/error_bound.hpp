@@ -0,0 +1,121 @@
+#pragma once
+
+#include "rigid_geometric_algebra/field_identity.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <functional>
+#include <limits>
+
+namespace rigid_geometric_algebra::detail {
+
+/// magnitude and rounding depth of a floating-point computation
+/// @tparam T floating-point type
+///
+/// Evaluating an expression of sums and products with `error_bound` values in
+/// place of its operands computes the sum of the absolute values of the terms
+/// of the expression and the largest number of rounded operations applied to
+/// any term. Negation is ignored and subtraction is treated as addition.
+///
+/// If no operation overflows or underflows, the error of evaluating the
+/// expression in `T` is at most `bound()`.
+///
+/// @see N. J. Higham, Accuracy and Stability of Numerical Algorithms, sec. 3.1
+///
+template <std::floating_point T>
+class error_bound
+{
+  T magnitude_{};
+  int depth_{};
+
+  constexpr error_bound(T magnitude, int depth) noexcept
+      : magnitude_{magnitude}, depth_{depth}
+  {}
+
+public:
+  /// constructs a bound for an exact zero
+  ///
+  error_bound() = default;
+
+  /// constructs a bound for an exact value
+  ///
+  constexpr error_bound(T value) noexcept : magnitude_{std::abs(value)} {}
+
+  /// sum of the absolute values of the terms
+  ///
+  [[nodiscard]]
+  constexpr auto magnitude() const noexcept -> T
+  {
+    return magnitude_;
+  }
+
+  /// largest number of rounded operations applied to a term
+  ///
+  [[nodiscard]]
+  constexpr auto depth() const noexcept -> int
+  {
+    return depth_;
+  }
+
+  /// bound on the absolute error of the computed value
+  ///
+  /// Returns `2 γ(depth) magnitude`, where `γ(n) = n u / (1 - n u)` and `u`
+  /// is the unit roundoff. The factor of 2 accounts for the rounding error of
+  /// `magnitude` and of this bound.
+  ///
+  [[nodiscard]]
+  constexpr auto bound() const noexcept -> T
+  {
+    constexpr auto u = std::numeric_limits<T>::epsilon() / T{2};
+    const auto nu = static_cast<T>(depth_) * u;
+    return T{2} * (nu / (T{1} - nu)) * magnitude_;
+  }
+
+  /// arithmetic operations
+  ///
+  /// @{
+
+  friend constexpr auto operator-(const error_bound& x) noexcept -> error_bound
+  {
+    return x;
+  }
+
+  friend constexpr auto
+  operator+(const error_bound& x, const error_bound& y) noexcept -> error_bound
+  {
+    return {x.magnitude_ + y.magnitude_, std::max(x.depth_, y.depth_) + 1};
+  }
+
+  friend constexpr auto
+  operator-(const error_bound& x, const error_bound& y) noexcept -> error_bound
+  {
+    return x + y;
+  }
+
+  friend constexpr auto
+  operator*(const error_bound& x, const error_bound& y) noexcept -> error_bound
+  {
+    return {x.magnitude_ * y.magnitude_, x.depth_ + y.depth_ + 1};
+  }
+
+  // required for `field` but not meaningful
+  friend constexpr auto
+  operator/(const error_bound& x, const error_bound& y) noexcept -> error_bound
+  {
+    return {x.magnitude_ / y.magnitude_, x.depth_ + y.depth_ + 1};
+  }
+
+  /// @}
+
+  friend auto
+  operator==(const error_bound&, const error_bound&) -> bool = default;
+};
+
+}  // namespace rigid_geometric_algebra::detail
+
+template <class T>
+inline constexpr auto ::rigid_geometric_algebra::field_identity<
+    ::rigid_geometric_algebra::detail::error_bound<T>,
+    std::multiplies<>> = ::rigid_geometric_algebra::detail::error_bound<T>{
+    T{1}};
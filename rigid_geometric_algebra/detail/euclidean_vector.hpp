@@ -0,0 +1,81 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/get.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/plane.hpp"
+
+#include <array>
+#include <cmath>
+
+namespace rigid_geometric_algebra::detail {
+
+/// three-dimensional Euclidean vector
+///
+template <class T>
+using euclidean_vector = std::array<T, 3>;
+
+/// direction of a line
+///
+template <class A>
+constexpr auto direction(const line<A>& l)
+    -> euclidean_vector<algebra_field_t<A>>
+{
+  const auto& v = l.multivector();
+  return {
+      get<typename A::template blade<0, 1>>(v).coefficient,
+      get<typename A::template blade<0, 2>>(v).coefficient,
+      get<typename A::template blade<0, 3>>(v).coefficient};
+}
+
+/// moment of a line
+///
+template <class A>
+constexpr auto moment(const line<A>& l) -> euclidean_vector<algebra_field_t<A>>
+{
+  const auto& v = l.multivector();
+  return {
+      get<typename A::template blade<2, 3>>(v).coefficient,
+      get<typename A::template blade<3, 1>>(v).coefficient,
+      get<typename A::template blade<1, 2>>(v).coefficient};
+}
+
+/// normal of a plane
+///
+template <class A>
+constexpr auto normal(const plane<A>& g)
+    -> euclidean_vector<algebra_field_t<A>>
+{
+  const auto& v = g.multivector();
+  return {
+      get<typename A::template blade<0, 2, 3>>(v).coefficient,
+      get<typename A::template blade<0, 3, 1>>(v).coefficient,
+      get<typename A::template blade<0, 1, 2>>(v).coefficient};
+}
+
+/// dot product
+///
+template <class T>
+constexpr auto dot(const euclidean_vector<T>& a, const euclidean_vector<T>& b)
+    -> T
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+/// Euclidean norm of the cross product
+///
+template <class T>
+auto cross_norm(const euclidean_vector<T>& a, const euclidean_vector<T>& b)
+    -> T
+{
+  using std::sqrt;
+
+  const auto x = a[1] * b[2] - a[2] * b[1];
+  const auto y = a[2] * b[0] - a[0] * b[2];
+  const auto z = a[0] * b[1] - a[1] * b[0];
+
+  return sqrt(x * x + y * y + z * z);
+}
+
+}  // namespace rigid_geometric_algebra::detail
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "rigid_geometric_algebra/detail/contract.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace rigid_geometric_algebra::detail {
+
+/// invokes a function on contiguous partitions of a sequence
+/// @param size number of elements in the sequence
+/// @param thread_count maximum number of partitions
+/// @param f function invocable with the offset and the number of elements of
+///   a partition
+///
+/// Partitions differ in size by at most one element. Each partition after
+/// the first is processed on a new thread and the first is processed on the
+/// calling thread. Returns after all partitions have been processed.
+///
+/// Batched operations taking a `thread_count` forward it here, so that
+/// `thread_count` contiguous ranges of the batch are each processed on their
+/// own thread. A function that checks preconditions on the elements of a
+/// partition checks all of them before the loop over the partition, so that
+/// the loop itself does not branch.
+///
+/// @pre `thread_count != 0`
+///
+template <class F>
+auto for_each_partition(std::size_t size, std::size_t thread_count, F f)
+    -> void
+{
+  detail::precondition(thread_count != 0);
+
+  const auto n = std::clamp(size, 1UZ, thread_count);
+  const auto offset = [size, n](std::size_t j) { return j * size / n; };
+
+  auto threads = std::vector<std::jthread>{};
+  threads.reserve(n - 1);
+
+  for (auto j = 1UZ; j != n; ++j) {
+    threads.emplace_back(f, offset(j), offset(j + 1) - offset(j));
+  }
+
+  f(offset(0), offset(1));
+}
+
+}  // namespace rigid_geometric_algebra::detail
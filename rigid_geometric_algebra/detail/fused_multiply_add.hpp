@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cmath>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+namespace rigid_geometric_algebra::detail {
+
+namespace fused_multiply_add_adl {
+
+// hides `fma` declared in enclosing namespaces, e.g. `::fma` from <cmath>,
+// so that only overloads found by argument-dependent lookup are used
+auto fma() -> void = delete;
+
+// whether `std::fma` is at least as fast as a multiplication and an addition
+// for `T`, as reported by the `FP_FAST_FMA` macros of <cmath>. Otherwise,
+// `std::fma` may be a call into a software implementation.
+template <class T>
+inline constexpr auto has_fast_fma = false;
+
+#ifdef FP_FAST_FMAF
+template <>
+inline constexpr auto has_fast_fma<float> = true;
+#endif
+
+#ifdef FP_FAST_FMA
+template <>
+inline constexpr auto has_fast_fma<double> = true;
+#endif
+
+#ifdef FP_FAST_FMAL
+template <>
+inline constexpr auto has_fast_fma<long double> = true;
+#endif
+
+template <class T1, class T2, class T3>
+concept fusable_floating_point =
+    std::floating_point<std::remove_cvref_t<T3>> and
+    std::same_as<std::remove_cvref_t<T1>, std::remove_cvref_t<T3>> and
+    std::same_as<std::remove_cvref_t<T2>, std::remove_cvref_t<T3>>;
+
+template <class T1, class T2, class T3>
+concept has_fma = requires (const T1& x, const T2& y, const T3& z) {
+  { fma(x, y, z) } -> std::same_as<std::remove_cvref_t<T3>>;
+};
+
+/// computes `x * y + z`
+///
+/// Uses `std::fma` for floating-point values of the same type, rounding only
+/// once, if `FP_FAST_FMA`, `FP_FAST_FMAF`, or `FP_FAST_FMAL` is defined for
+/// the type, and an `fma` overload found by argument-dependent lookup if one
+/// exists. Otherwise, `x * y + z` is evaluated directly.
+///
+/// During constant evaluation, floating-point values are not fused.
+///
+class fused_multiply_add_fn
+{
+public:
+  template <class T1, class T2, class T3>
+    requires fusable_floating_point<T1, T2, T3>
+  static constexpr auto operator()(T1 x, T2 y, T3 z) noexcept -> T3
+  {
+    if consteval {
+      return x * y + z;
+    } else {
+      if constexpr (has_fast_fma<T3>) {
+        return std::fma(x, y, z);
+      } else {
+        return x * y + z;
+      }
+    }
+  }
+
+  template <class T1, class T2, class T3>
+    requires (not fusable_floating_point<T1, T2, T3>) and
+             has_fma<T1, T2, T3>
+  static constexpr auto operator()(const T1& x, const T2& y, const T3& z)
+      -> std::remove_cvref_t<T3>
+  {
+    return fma(x, y, z);
+  }
+
+  template <class T1, class T2, class T3>
+    requires (not fusable_floating_point<T1, T2, T3>) and
+             (not has_fma<T1, T2, T3>) and
+             requires (const T1& x, const T2& y, const T3& z) {
+               {
+                 x * y + z
+               } -> std::convertible_to<std::remove_cvref_t<T3>>;
+             }
+  static constexpr auto operator()(const T1& x, const T2& y, const T3& z)
+      -> std::remove_cvref_t<T3>
+  {
+    return x * y + z;
+  }
+};
+
+}  // namespace fused_multiply_add_adl
+
+using fused_multiply_add_adl::fused_multiply_add_fn;
+
+inline constexpr auto fused_multiply_add = fused_multiply_add_fn{};
+
+}  // namespace rigid_geometric_algebra::detail
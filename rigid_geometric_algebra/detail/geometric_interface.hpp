@@ -218,11 +218,13 @@ public:
       : values_{[il] {
           detail::precondition(
               il.size() == multivector_type::size,
-              detail::contract_violation_handler{
-                  "size of initializer_list '{}' must match underlying "
-                  "multivector size '{}'",
-                  il.size(),
-                  multivector_type::size()});
+              [m = il.size(), n = multivector_type::size()] {
+                return detail::contract_violation_handler{
+                    "size of initializer_list '{}' must match underlying "
+                    "multivector size '{}'",
+                    m,
+                    n};
+              });
           return il;
         }()}
   {}
@@ -274,10 +276,10 @@ public:
       std::ranges::range_reference_t<Self&&>,
       std::ranges::range_rvalue_reference_t<Self&&>>
   {
-    detail::precondition(
-        i < multivector_type::size,
-        detail::contract_violation_handler{
-            "index value '{}' not less than size '{}'", i, size()});
+    detail::precondition(i < multivector_type::size, [i, n = size()] {
+      return detail::contract_violation_handler{
+          "index value '{}' not less than size '{}'", i, n};
+    });
 
     using D = iterator<true>::difference_type;
     using R = std::conditional_t<
@@ -340,14 +342,15 @@ struct ::std::
 template <class V>
 struct ::glz::meta<::rigid_geometric_algebra::detail::geometric_interface<V>>
 {
+  // `P` is a tuple of references to the blades
   template <class P>
   struct geometric_wrapper
   {
-    std::reference_wrapper<P> point;
+    P point;
   };
 
   template <class T>
-  geometric_wrapper(T&) -> geometric_wrapper<T>;
+  geometric_wrapper(T) -> geometric_wrapper<T>;
 
   static constexpr auto value = [](auto& self) {
     return geometric_wrapper{self.multivector().as_tuple()};
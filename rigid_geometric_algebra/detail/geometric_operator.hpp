@@ -35,7 +35,8 @@ public:
   using to_geometric_type_fn<to>::operator()...;
 };
 
-inline constexpr auto to_geometric = to_geometric_fn<point, line, plane>{};
+inline constexpr auto to_geometric =
+    to_geometric_fn<point, line, plane, motor>{};
 
 /// @}
 
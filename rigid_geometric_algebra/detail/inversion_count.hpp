@@ -0,0 +1,60 @@
+#pragma once
+
+#include "rigid_geometric_algebra/detail/contract.hpp"
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+
+namespace rigid_geometric_algebra::detail {
+
+/// number of inversions in the concatenation of ranges of unique values
+///
+/// Counts the pairs of elements where the larger value precedes the smaller
+/// value. The parity of the count is the parity of the permutation that sorts
+/// the elements, i.e. the parity of the number of swaps returned by
+/// `counted_sort`, without copying or sorting the elements.
+///
+/// Elements are tracked with a bitmask of the values seen so far and each
+/// element contributes the number of larger values already seen.
+///
+/// @pre values are unique and less than 64
+///
+inline constexpr class
+{
+  using mask_type = std::uint64_t;
+
+public:
+  template <std::ranges::input_range... Rs>
+    requires (
+        std::unsigned_integral<std::ranges::range_value_t<Rs>> and ...)
+  static constexpr auto operator()(const Rs&... ranges) -> std::size_t
+  {
+    auto seen = mask_type{};
+    auto count = 0UZ;
+
+    const auto add = [&seen, &count](std::size_t value) {
+      detail::precondition(value < 64, "value must be less than 64");
+
+      const auto bit = mask_type{1} << value;
+      detail::precondition((seen & bit) == 0, "values must be unique");
+
+      count += static_cast<std::size_t>(std::popcount(seen & ~(bit - 1)));
+      seen |= bit;
+    };
+
+    (
+        [&add](const auto& range) {
+          for (const auto value : range) {
+            add(static_cast<std::size_t>(value));
+          }
+        }(ranges),
+        ...);
+
+    return count;
+  }
+} inversion_count{};
+
+}  // namespace rigid_geometric_algebra::detail
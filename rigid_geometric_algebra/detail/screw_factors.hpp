@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cmath>
+
+namespace rigid_geometric_algebra::detail {
+
+/// trigonometric factors of the exponential of a line
+/// @tparam T field type
+///
+/// For an angle `x`, holds
+/// * `cos(x)`
+/// * `sin(x) / x`
+/// * `(x * cos(x) - sin(x)) / x^3`
+///
+/// The last two factors are replaced by their Taylor polynomials near zero,
+/// where the closed forms divide by zero or lose precision to cancellation.
+/// Both forms are always evaluated and the result is selected without
+/// branching, allowing loops over many angles to be vectorized.
+///
+template <class T>
+struct screw_factors
+{
+  T cosine{};
+  T sinc{};
+  T dsinc{};
+
+  static auto from_angle(const T& x) -> screw_factors
+  {
+    using std::cos;
+    using std::sin;
+
+    const auto x2 = x * x;
+    const auto near_zero = x2 < T{1} / T{64};
+    const auto safe_x = near_zero ? T{1} : x;
+
+    const auto c = cos(x);
+    const auto s = sin(x);
+
+    const auto sinc_closed = s / safe_x;
+    const auto dsinc_closed = (x * c - s) / (safe_x * safe_x * safe_x);
+
+    // 1 - x^2/6 + x^4/120 - x^6/5040 + x^8/362880
+    const auto sinc_series =
+        T{1} -
+        x2 / T{6} *
+            (T{1} - x2 / T{20} * (T{1} - x2 / T{42} * (T{1} - x2 / T{72})));
+
+    // -1/3 + x^2/30 - x^4/840 + x^6/45360 - x^8/3991680
+    const auto dsinc_series =
+        -(T{1} -
+          x2 / T{10} *
+              (T{1} - x2 / T{28} * (T{1} - x2 / T{54} * (T{1} - x2 / T{88})))) /
+        T{3};
+
+    return {
+        c,
+        near_zero ? sinc_series : sinc_closed,
+        near_zero ? dsinc_series : dsinc_closed};
+  }
+};
+
+}  // namespace rigid_geometric_algebra::detail
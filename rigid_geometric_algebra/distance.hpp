@@ -0,0 +1,158 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/antiwedge.hpp"
+#include "rigid_geometric_algebra/detail/derive_soa_overload.hpp"
+#include "rigid_geometric_algebra/detail/euclidean_vector.hpp"
+#include "rigid_geometric_algebra/get.hpp"
+#include "rigid_geometric_algebra/homogeneous_magnitude.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/norm.hpp"
+#include "rigid_geometric_algebra/plane.hpp"
+#include "rigid_geometric_algebra/point.hpp"
+#include "rigid_geometric_algebra/wedge.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class distance_value_fn
+{
+  template <class V>
+  static constexpr auto scalar_coefficient(const V& v)
+  {
+    using std::abs;
+    using A = algebra_type_t<V>;
+    return abs(get<typename A::template blade<>>(v).coefficient);
+  }
+
+public:
+  template <class A>
+  static auto operator()(const point<A>& p, const point<A>& q)
+      -> homogeneous_magnitude_t<A>
+  {
+    return homogeneous_magnitude<A>(
+        weight_norm(wedge(p.multivector(), q.multivector())),
+        weight_norm(p) * weight_norm(q));
+  }
+
+  template <class A>
+  static auto operator()(const point<A>& p, const line<A>& l)
+      -> homogeneous_magnitude_t<A>
+  {
+    return homogeneous_magnitude<A>(
+        weight_norm(wedge(l.multivector(), p.multivector())),
+        weight_norm(p) * weight_norm(l));
+  }
+
+  template <class A>
+  static auto operator()(const point<A>& p, const plane<A>& g)
+      -> homogeneous_magnitude_t<A>
+  {
+    return homogeneous_magnitude<A>(
+        scalar_coefficient(antiwedge(p.multivector(), g.multivector())),
+        weight_norm(p) * weight_norm(g));
+  }
+
+  template <class A>
+  static auto operator()(const line<A>& k, const line<A>& l)
+      -> homogeneous_magnitude_t<A>
+  {
+    using std::abs;
+    using std::sqrt;
+    using T = algebra_field_t<A>;
+
+    const auto u = detail::direction(k);
+    const auto v = detail::direction(l);
+    const auto uu = detail::dot(u, u);
+
+    // As in `closest_points`, lines are parallel if the sine of the angle
+    // between them is at most `sqrt(epsilon)`. Otherwise, rounding error in
+    // `antiwedge(k, l)` would be divided by a tiny cross product.
+    if (const auto c = detail::cross_norm(u, v);
+        c * c > std::numeric_limits<T>::epsilon() * uu * detail::dot(v, v)) {
+      return homogeneous_magnitude<A>(
+          scalar_coefficient(antiwedge(k.multivector(), l.multivector())), c);
+    }
+
+    // For parallel lines, `v = s u` and the moments satisfy
+    // `m - n / s = cross(x - y, u)` for points `x` on `k` and `y` on `l`,
+    // whose norm is the distance scaled by `|u|`. Multiplying by
+    // `dot(u, v) = s dot(u, u)` avoids the division.
+    const auto m = detail::moment(k);
+    const auto n = detail::moment(l);
+    const auto uv = detail::dot(u, v);
+
+    const auto w = detail::euclidean_vector<T>{
+        m[0] * uv - n[0] * uu, m[1] * uv - n[1] * uu, m[2] * uv - n[2] * uu};
+
+    return homogeneous_magnitude<A>(
+        sqrt(detail::dot(w, w)), sqrt(uu) * abs(uv));
+  }
+
+  template <class A>
+  static auto operator()(const plane<A>& g, const plane<A>& h)
+      -> homogeneous_magnitude_t<A>
+  {
+    return homogeneous_magnitude<A>(
+        bulk_norm(antiwedge(g.multivector(), h.multivector())),
+        weight_norm(g) * weight_norm(h));
+  }
+
+  template <class A>
+  static auto operator()(const line<A>& l, const point<A>& p)
+      -> homogeneous_magnitude_t<A>
+  {
+    return operator()(p, l);
+  }
+
+  template <class A>
+  static auto operator()(const plane<A>& g, const point<A>& p)
+      -> homogeneous_magnitude_t<A>
+  {
+    return operator()(p, g);
+  }
+};
+
+class distance_fn : public distance_value_fn,
+                    public derive_soa_overload<distance_value_fn>
+{
+public:
+  using distance_value_fn::operator();
+  using derive_soa_overload<distance_value_fn>::operator();
+};
+
+}  // namespace detail
+
+/// Euclidean distance
+/// @param a, b points, lines, or planes
+///
+/// Returns the distance between `a` and `b` as a homogeneous magnitude. The
+/// arguments need not be unitized. The numerator is
+/// * `weight_norm(a ^ b)` for two points or a point and a line
+/// * the magnitude of `antiwedge(a, b)` for a point and a plane, or for two
+///   lines
+/// * `bulk_norm(antiwedge(a, b))` for two planes
+///
+/// and the denominator is the product of the weight norms of `a` and `b`,
+/// except for two lines, where it is the norm of the cross product of their
+/// directions.
+///
+/// For lines that are parallel within a tolerance, where the sine of the
+/// angle between their directions is at most the square root of the machine
+/// epsilon of the field, the distance is instead computed from the
+/// difference of the moments, with the moment of `b` scaled to the direction
+/// of `a`, divided by the norm of the direction of `a`. Coincident lines have
+/// a distance of zero.
+///
+/// The result for two planes is only meaningful if the planes are parallel.
+///
+/// Batches may be evaluated with `distance(as, bs, out)` or, for a single
+/// `b`, with `distance(as, b, out)`, where `as`, `bs`, and `out` are
+/// `soa_span`s.
+///
+inline constexpr auto distance = detail::distance_fn{};
+
+}  // namespace rigid_geometric_algebra
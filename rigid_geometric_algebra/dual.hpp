@@ -0,0 +1,64 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/complement.hpp"
+#include "rigid_geometric_algebra/detail/linear_operator.hpp"
+#include "rigid_geometric_algebra/is_blade.hpp"
+#include "rigid_geometric_algebra/zero_constant_fwd.hpp"
+
+#include <type_traits>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+/// right complement of the bulk (or weight) of a blade
+/// @tparam Weight `false` for the bulk dual, `true` for the weight dual
+///
+/// A blade is part of the weight if it contains the projective dimension and
+/// part of the bulk otherwise.
+///
+template <bool Weight>
+class dual_blade_fn
+{
+  template <detail::blade B>
+  static constexpr auto is_selected_v =
+      std::remove_cvref_t<B>::dimension_mask.test(0) == Weight;
+
+public:
+  template <detail::blade B>
+    requires is_selected_v<B>
+  static constexpr auto operator()(const B& b) -> decltype(right_complement(b))
+  {
+    return right_complement(b);
+  }
+
+  template <detail::blade B>
+    requires (not is_selected_v<B>)
+  static constexpr auto operator()(const B&) -> zero_constant<algebra_type_t<B>>
+  {
+    return {};
+  }
+};
+
+}  // namespace detail
+
+/// bulk dual
+///
+/// Returns the right complement of the bulk of an element, the blades that do
+/// not contain the projective dimension.
+///
+inline constexpr auto bulk_dual =
+    detail::linear_operator<detail::dual_blade_fn<false>>{};
+
+/// weight dual
+///
+/// Returns the right complement of the weight of an element, the blades that
+/// contain the projective dimension.
+///
+/// The weight dual of a plane is its normal direction, and the weight dual of
+/// a line is its direction as a line at infinity.
+///
+inline constexpr auto weight_dual =
+    detail::linear_operator<detail::dual_blade_fn<true>>{};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,221 @@
+#pragma once
+
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/field_identity.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+
+namespace rigid_geometric_algebra {
+
+/// value with a gradient, for forward-mode automatic differentiation
+/// @tparam T floating-point type
+/// @tparam N number of independent variables
+///
+/// A `dual_number` holds a value and its partial derivatives with respect to
+/// `N` variables. Arithmetic operations and the functions `sqrt`, `sin`,
+/// `cos`, and `atan2` propagate the derivatives with the chain rule, so that
+/// evaluating any operator of an `algebra` with `dual_number` coefficients
+/// also computes the derivatives of the result.
+///
+/// The derivatives are stored contiguously and each operation updates all of
+/// them with a single loop, allowing the loop to be vectorized.
+///
+/// Equality compares the value and the gradient, while ordering only
+/// considers the value. `sqrt` is not differentiable at zero, and its
+/// derivative there is taken to be zero by convention. This allows the
+/// exponential of a line to be differentiated at the identity. Likewise, the derivatives of `atan2(y, x)` at the origin are
+/// taken to be zero, so that the logarithm of a motor, which evaluates
+/// `atan2` of the norm of its weight, can be differentiated at the identity.
+///
+/// `dual_number` models `field`. The line invariant is not checked for
+/// `dual_number` values.
+///
+template <std::floating_point T, std::size_t N>
+class dual_number
+{
+public:
+  /// gradient type
+  ///
+  using gradient_type = std::array<T, N>;
+
+  /// value
+  ///
+  T value{};
+
+  /// partial derivatives of the value
+  ///
+  gradient_type gradient{};
+
+  /// constructs zero
+  ///
+  dual_number() = default;
+
+  /// constructs a constant
+  ///
+  constexpr dual_number(T v) noexcept : value{v} {}
+
+  /// constructs a value with a gradient
+  ///
+  constexpr dual_number(T v, const gradient_type& g) noexcept
+      : value{v}, gradient{g}
+  {}
+
+  /// constructs the `i`-th independent variable
+  /// @param v value
+  /// @param i variable index
+  ///
+  /// @pre `i < N`
+  ///
+  static constexpr auto variable(T v, std::size_t i) -> dual_number
+  {
+    detail::precondition(i < N);
+
+    auto x = dual_number{v};
+    x.gradient[i] = T{1};
+    return x;
+  }
+
+private:
+  // value with gradient `a g1 + b g2`
+  static constexpr auto combine(
+      T v, T a, const gradient_type& g1, T b, const gradient_type& g2) noexcept
+      -> dual_number
+  {
+    auto x = dual_number{v};
+    for (auto i = 0UZ; i != N; ++i) {
+      x.gradient[i] = (a * g1[i]) + (b * g2[i]);
+    }
+    return x;
+  }
+
+  // value with gradient `a g`
+  static constexpr auto
+  scale(T v, T a, const gradient_type& g) noexcept -> dual_number
+  {
+    auto x = dual_number{v};
+    for (auto i = 0UZ; i != N; ++i) {
+      x.gradient[i] = a * g[i];
+    }
+    return x;
+  }
+
+public:
+  /// arithmetic operations
+  ///
+  /// @{
+
+  friend constexpr auto operator-(const dual_number& x) noexcept -> dual_number
+  {
+    return scale(-x.value, T{-1}, x.gradient);
+  }
+
+  friend constexpr auto
+  operator+(const dual_number& x, const dual_number& y) noexcept -> dual_number
+  {
+    return combine(x.value + y.value, T{1}, x.gradient, T{1}, y.gradient);
+  }
+
+  friend constexpr auto
+  operator-(const dual_number& x, const dual_number& y) noexcept -> dual_number
+  {
+    return combine(x.value - y.value, T{1}, x.gradient, T{-1}, y.gradient);
+  }
+
+  friend constexpr auto
+  operator*(const dual_number& x, const dual_number& y) noexcept -> dual_number
+  {
+    return combine(x.value * y.value, y.value, x.gradient, x.value, y.gradient);
+  }
+
+  friend constexpr auto
+  operator/(const dual_number& x, const dual_number& y) noexcept -> dual_number
+  {
+    const auto q = x.value / y.value;
+    const auto r = T{1} / y.value;
+    return combine(q, r, x.gradient, -q * r, y.gradient);
+  }
+
+  /// @}
+
+  /// elementary functions
+  ///
+  /// @{
+
+  friend auto sqrt(const dual_number& x) -> dual_number
+  {
+    using std::sqrt;
+    const auto s = sqrt(x.value);
+    return scale(s, s == T{} ? T{} : T{1} / (T{2} * s), x.gradient);
+  }
+
+  friend auto sin(const dual_number& x) -> dual_number
+  {
+    using std::cos;
+    using std::sin;
+    return scale(sin(x.value), cos(x.value), x.gradient);
+  }
+
+  friend auto cos(const dual_number& x) -> dual_number
+  {
+    using std::cos;
+    using std::sin;
+    return scale(cos(x.value), -sin(x.value), x.gradient);
+  }
+
+  friend auto atan2(const dual_number& y, const dual_number& x) -> dual_number
+  {
+    using std::atan2;
+    const auto r2 = (x.value * x.value) + (y.value * y.value);
+    const auto s = r2 == T{} ? T{} : T{1} / r2;
+    return combine(
+        atan2(y.value, x.value),
+        x.value * s,
+        y.gradient,
+        -y.value * s,
+        x.gradient);
+  }
+
+  /// @}
+
+  /// comparison
+  ///
+  /// Equality compares the value and the gradient. Ordering only compares the
+  /// value.
+  ///
+  /// @{
+
+  friend auto
+  operator==(const dual_number&, const dual_number&) -> bool = default;
+
+  friend constexpr auto
+  operator<(const dual_number& x, const dual_number& y) noexcept -> bool
+  {
+    return x.value < y.value;
+  }
+
+  friend constexpr auto
+  operator>(const dual_number& x, const dual_number& y) noexcept -> bool
+  {
+    return y < x;
+  }
+
+  /// @}
+};
+
+/// field identity value for dual number multiplication
+///
+template <class T, std::size_t N>
+inline constexpr auto field_identity<dual_number<T, N>, std::multiplies<>> =
+    dual_number<T, N>{T{1}};
+
+/// disable line invariant checks for dual numbers
+///
+template <class T, std::size_t N>
+inline constexpr auto disable_line_invariant<dual_number<T, N>> = true;
+
+}  // namespace rigid_geometric_algebra
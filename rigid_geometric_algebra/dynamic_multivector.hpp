@@ -0,0 +1,393 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/blade_dimensions.hpp"
+#include "rigid_geometric_algebra/detail/cayley_table.hpp"
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/detail/dynamic_operator.hpp"
+#include "rigid_geometric_algebra/detail/type_list.hpp"
+#include "rigid_geometric_algebra/dynamic_multivector_fwd.hpp"
+#include "rigid_geometric_algebra/field.hpp"
+#include "rigid_geometric_algebra/geometric_fwd.hpp"
+#include "rigid_geometric_algebra/multivector.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace rigid_geometric_algebra {
+
+/// multivector with a runtime algebra dimension and blade set
+/// @tparam T field type
+///
+/// A `dynamic_multivector` stores the coefficients of a subset of the blades
+/// of an algebra with dimension `dimension()`, where both the dimension and
+/// the subset are only known at run time. Each stored coefficient is paired
+/// with the dimension mask of its blade, where bit `i` is set if the blade
+/// contains `blade<A, i>`, and coefficients are stored in canonical blade
+/// order. As with `multivector`, coefficients refer to blades with dimensions
+/// in canonical order, e.g. `e31` rather than `e13`.
+///
+/// ```
+/// using G3 = algebra<double, 3>;
+///
+/// const auto p = dynamic_multivector<double>{G3::point{1, 2, 3, 4}};
+/// const auto q = dynamic_multivector<double>{4, {{0b0001, 1}, {0b0010, 1}}};
+///
+/// const auto l = wedge(p, q);
+/// const auto v = static_cast<G3::line::multivector_type>(l);
+/// ```
+///
+/// `geometric_product`, `geometric_antiproduct`, `wedge`, and `antiwedge`
+/// are evaluated with runtime Cayley tables, built on first use for each
+/// algebra dimension with the same sign rules as the blade overloads. The
+/// blades of a product are the blades with a nonzero entry in the table for
+/// a pair of stored blades, matching the blades of the corresponding
+/// `multivector` result.
+///
+/// Algebra dimensions from 2 to 8 are supported.
+///
+template <field T>
+class dynamic_multivector
+{
+public:
+  /// field type
+  ///
+  using value_type = T;
+
+  /// dimension mask of a blade
+  ///
+  using mask_type = std::uint8_t;
+
+  /// coefficient of a blade
+  ///
+  struct term
+  {
+    mask_type mask{};
+    value_type coefficient{};
+
+    friend auto operator==(const term&, const term&) -> bool = default;
+  };
+
+private:
+  template <detail::cayley_product>
+  friend class detail::dynamic_operator;
+
+  const detail::cayley_tables* tables_{};
+  std::vector<term> terms_;
+
+  dynamic_multivector(const detail::cayley_tables& tables, std::vector<term> t)
+      : tables_{&tables}, terms_{std::move(t)}
+  {}
+
+  [[nodiscard]]
+  auto rank(mask_type mask) const -> std::size_t
+  {
+    return tables_->rank[mask];
+  }
+
+  // sorts terms in canonical blade order and combines terms of the same blade
+  auto normalize() -> void
+  {
+    for (const auto& t : terms_) {
+      detail::precondition(
+          (std::size_t{t.mask} >> dimension()) == 0,
+          [mask = t.mask, n = dimension()] {
+            return detail::contract_violation_handler{
+                "blade mask '{:#b}' exceeds algebra dimension '{}'", mask, n};
+          });
+    }
+
+    std::ranges::stable_sort(
+        terms_, {}, [this](const term& t) { return rank(t.mask); });
+
+    auto out = terms_.begin();
+    for (auto it = terms_.begin(); it != terms_.end(); ++it) {
+      if (out != terms_.begin() and std::prev(out)->mask == it->mask) {
+        std::prev(out)->coefficient =
+            std::prev(out)->coefficient + it->coefficient;
+      } else {
+        *out++ = std::move(*it);
+      }
+    }
+    terms_.erase(out, terms_.end());
+  }
+
+  // merges the terms of `x` and `y`, applying `f` to coefficients of blades
+  // in both and `g` to coefficients of blades only in `y`
+  template <class F, class G>
+  static auto merge(
+      const dynamic_multivector& x, const dynamic_multivector& y, F f, G g)
+      -> dynamic_multivector
+  {
+    detail::precondition(
+        x.tables_ == y.tables_, "algebra dimensions must match");
+
+    auto terms = std::vector<term>{};
+    terms.reserve(x.terms_.size() + y.terms_.size());
+
+    auto i = x.terms_.begin();
+    auto j = y.terms_.begin();
+    while (i != x.terms_.end() or j != y.terms_.end()) {
+      if (j == y.terms_.end() or
+          (i != x.terms_.end() and x.rank(i->mask) < x.rank(j->mask))) {
+        terms.push_back(*i++);
+      } else if (i == x.terms_.end() or x.rank(j->mask) < x.rank(i->mask)) {
+        terms.push_back({j->mask, g(j->coefficient)});
+        ++j;
+      } else {
+        terms.push_back({i->mask, f(i->coefficient, j->coefficient)});
+        ++i;
+        ++j;
+      }
+    }
+
+    return {*x.tables_, std::move(terms)};
+  }
+
+  template <detail::cayley_product P>
+  static auto
+  product(const dynamic_multivector& x, const dynamic_multivector& y)
+      -> dynamic_multivector
+  {
+    detail::precondition(
+        x.tables_ == y.tables_, "algebra dimensions must match");
+
+    const auto& tables = *x.tables_;
+    const auto n = tables.blades.size();
+
+    // accumulate products of blade pairs by blade mask
+    auto sums = std::vector<value_type>(n);
+    auto present = std::vector<bool>(n);
+
+    for (const auto& a : x.terms_) {
+      for (const auto& b : y.terms_) {
+        const auto e = tables(P, a.mask, b.mask);
+        if (e.sign == 0) {
+          continue;
+        }
+
+        auto c = a.coefficient * b.coefficient;
+        if (e.sign < 0) {
+          c = -c;
+        }
+        sums[e.mask] = present[e.mask] ? sums[e.mask] + c : std::move(c);
+        present[e.mask] = true;
+      }
+    }
+
+    auto terms = std::vector<term>{};
+    for (const auto mask : tables.blades) {
+      if (present[mask]) {
+        terms.push_back({mask, std::move(sums[mask])});
+      }
+    }
+
+    return {tables, std::move(terms)};
+  }
+
+public:
+  /// constructs a multivector without blades
+  /// @param dimension algebra dimension
+  ///
+  /// @pre `2 <= dimension and dimension <= 8`
+  ///
+  explicit dynamic_multivector(std::size_t dimension)
+      : tables_{&detail::cayley_tables_for(dimension)}
+  {}
+
+  /// constructs a multivector from a range of terms
+  /// @param dimension algebra dimension
+  /// @param terms blade masks and coefficients, in any order
+  ///
+  /// Coefficients of terms with the same blade mask are added.
+  ///
+  /// @pre `2 <= dimension and dimension <= 8`
+  /// @pre each blade mask is less than `2^dimension`
+  ///
+  template <std::ranges::input_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, term>
+  dynamic_multivector(std::size_t dimension, R&& terms)
+      : tables_{&detail::cayley_tables_for(dimension)}
+  {
+    for (auto&& t : terms) {
+      terms_.push_back(std::forward<decltype(t)>(t));
+    }
+    normalize();
+  }
+
+  /// @copydoc dynamic_multivector(std::size_t, R&&)
+  ///
+  dynamic_multivector(std::size_t dimension, std::initializer_list<term> terms)
+      : dynamic_multivector{dimension, std::span{terms}}
+  {}
+
+  /// constructs from a `multivector`
+  ///
+  template <class A, blade_dimensions... D>
+    requires std::same_as<algebra_field_t<A>, value_type>
+  explicit dynamic_multivector(const multivector<A, D...>& v)
+      : tables_{&detail::cayley_tables_for(algebra_dimension_v<A>)}
+  {
+    terms_.reserve(sizeof...(D));
+
+    [this, &v]<class... Bs>(detail::type_list<Bs...>) {
+      (terms_.push_back(
+           {static_cast<mask_type>(Bs::dimension_mask.to_unsigned()),
+            v.template get<Bs>().coefficient}),
+       ...);
+    }(typename multivector<A, D...>::blade_list_type{});
+
+    normalize();
+  }
+
+  /// constructs from a geometric type
+  ///
+  template <detail::geometric G>
+    requires std::constructible_from<
+        dynamic_multivector,
+        const typename G::multivector_type&>
+  explicit dynamic_multivector(const G& g)
+      : dynamic_multivector{g.multivector()}
+  {}
+
+  /// converts to a `multivector`
+  ///
+  /// @pre `dimension() == algebra_dimension_v<A>`
+  /// @pre each stored blade is a blade of `multivector<A, D...>`
+  ///
+  template <class A, blade_dimensions... D>
+    requires std::same_as<algebra_field_t<A>, value_type>
+  explicit operator multivector<A, D...>() const
+  {
+    using V = multivector<A, D...>;
+
+    detail::precondition(
+        dimension() == algebra_dimension_v<A>,
+        [n = dimension(), m = algebra_dimension_v<A>] {
+          return detail::contract_violation_handler{
+              "algebra dimension '{}' does not match '{}'", n, m};
+        });
+
+    auto v = V{};
+    for (const auto& t : terms_) {
+      const auto assigned = [&v, &t]<class... Bs>(detail::type_list<Bs...>) {
+        return (
+            (Bs::dimension_mask.to_unsigned() == t.mask and
+             (v.template get<Bs>().coefficient = t.coefficient, true)) or
+            ...);
+      }(typename V::blade_list_type{});
+
+      detail::precondition(assigned, [mask = t.mask] {
+        return detail::contract_violation_handler{
+            "blade mask '{:#b}' is not a blade of the target multivector",
+            mask};
+      });
+    }
+    return v;
+  }
+
+  /// algebra dimension
+  ///
+  [[nodiscard]]
+  auto dimension() const noexcept -> std::size_t
+  {
+    return tables_->dimension;
+  }
+
+  /// number of stored blades
+  ///
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t
+  {
+    return terms_.size();
+  }
+
+  /// stored blades and coefficients, in canonical blade order
+  ///
+  [[nodiscard]]
+  auto terms() const noexcept -> std::span<const term>
+  {
+    return terms_;
+  }
+
+  /// coefficient of a blade, or zero if the blade is not stored
+  /// @param mask blade dimension mask
+  ///
+  [[nodiscard]]
+  auto coefficient(mask_type mask) const -> value_type
+  {
+    const auto it = std::ranges::find(terms_, mask, &term::mask);
+    return it == terms_.end() ? value_type{} : it->coefficient;
+  }
+
+  /// vector space operations
+  ///
+  /// Addition and subtraction store the union of the blades of both operands.
+  ///
+  /// @pre `x.dimension() == y.dimension()`
+  ///
+  /// @{
+
+  friend auto operator-(const dynamic_multivector& x) -> dynamic_multivector
+  {
+    auto terms = x.terms_;
+    for (auto& t : terms) {
+      t.coefficient = -t.coefficient;
+    }
+    return {*x.tables_, std::move(terms)};
+  }
+
+  friend auto
+  operator+(const dynamic_multivector& x, const dynamic_multivector& y)
+      -> dynamic_multivector
+  {
+    return merge(
+        x,
+        y,
+        [](const value_type& a, const value_type& b) { return a + b; },
+        [](const value_type& b) { return b; });
+  }
+
+  friend auto
+  operator-(const dynamic_multivector& x, const dynamic_multivector& y)
+      -> dynamic_multivector
+  {
+    return merge(
+        x,
+        y,
+        [](const value_type& a, const value_type& b) { return a - b; },
+        [](const value_type& b) { return -b; });
+  }
+
+  friend auto operator*(const value_type& s, const dynamic_multivector& x)
+      -> dynamic_multivector
+  {
+    auto terms = x.terms_;
+    for (auto& t : terms) {
+      t.coefficient = s * t.coefficient;
+    }
+    return {*x.tables_, std::move(terms)};
+  }
+
+  /// @}
+
+  /// equality comparison
+  ///
+  /// Multivectors are equal if they have the same dimension and store the
+  /// same blades with equal coefficients.
+  ///
+  friend auto
+  operator==(const dynamic_multivector&, const dynamic_multivector&)
+      -> bool = default;
+};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "rigid_geometric_algebra/field.hpp"
+
+namespace rigid_geometric_algebra {
+
+// forward declaration
+//
+template <field T>
+class dynamic_multivector;
+
+}  // namespace rigid_geometric_algebra
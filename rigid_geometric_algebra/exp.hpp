@@ -0,0 +1,98 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/blade_sum.hpp"
+#include "rigid_geometric_algebra/detail/derive_soa_overload.hpp"
+#include "rigid_geometric_algebra/detail/screw_factors.hpp"
+#include "rigid_geometric_algebra/get.hpp"
+#include "rigid_geometric_algebra/is_multivector.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/motor.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class exp_value_fn
+{
+public:
+  template <detail::multivector V, class A = algebra_type_t<V>>
+    requires (algebra_dimension_v<A> == 4) and
+             std::is_same_v<
+                 std::remove_cvref_t<V>,
+                 typename line<A>::multivector_type>
+  static auto operator()(const V& l) -> motor<A>
+  {
+    using T = algebra_field_t<A>;
+    using std::sqrt;
+
+    const auto& vx = get<typename A::template blade<0, 1>>(l).coefficient;
+    const auto& vy = get<typename A::template blade<0, 2>>(l).coefficient;
+    const auto& vz = get<typename A::template blade<0, 3>>(l).coefficient;
+    const auto& mx = get<typename A::template blade<2, 3>>(l).coefficient;
+    const auto& my = get<typename A::template blade<3, 1>>(l).coefficient;
+    const auto& mz = get<typename A::template blade<1, 2>>(l).coefficient;
+
+    const auto f =
+        screw_factors<T>::from_angle(sqrt(vx * vx + vy * vy + vz * vz));
+    const auto vm = vx * mx + vy * my + vz * mz;
+    const auto k = vm * f.dsinc;
+
+    return motor<A>{blade_sum(
+        typename A::template blade<>{vm * f.sinc},
+        typename A::template blade<0, 1>{f.sinc * vx},
+        typename A::template blade<0, 2>{f.sinc * vy},
+        typename A::template blade<0, 3>{f.sinc * vz},
+        typename A::template blade<2, 3>{f.sinc * mx + k * vx},
+        typename A::template blade<3, 1>{f.sinc * my + k * vy},
+        typename A::template blade<1, 2>{f.sinc * mz + k * vz},
+        typename A::template blade<0, 1, 2, 3>{f.cosine})};
+  }
+
+  template <class A>
+  static auto operator()(const line<A>& l)
+      -> decltype(operator()(l.multivector()))
+  {
+    return operator()(l.multivector());
+  }
+};
+
+class exp_fn : public exp_value_fn, public derive_soa_overload<exp_value_fn>
+{
+public:
+  using exp_value_fn::operator();
+  using derive_soa_overload<exp_value_fn>::operator();
+};
+
+}  // namespace detail
+
+/// exponential of a line
+/// @param l line or bivector `multivector`
+///
+/// Returns the motor `exp(l)`, where the exponential is the power series of
+/// the geometric antiproduct with the unit hypervolume as the identity.
+///
+/// For a line with direction `v` and moment `m`, let `x = |v|` and
+/// `k = dot(v, m)`. The series has the closed form:
+/// ```
+/// cos(x) 𝟙 + k sinc(x) 1 + sinc(x) l + k dsinc(x) (v as bulk)
+/// ```
+/// where `sinc(x) = sin(x) / x` and `dsinc(x) = (x cos(x) - sin(x)) / x^3`.
+///
+/// For a unitized line `l`, `exp(φ/2 l)` rotates by `-φ` about the direction
+/// of `l`. For a line at infinity with moment `m`, `exp(l)` translates by
+/// `-2 m`.
+///
+/// Small values of `x` use Taylor polynomials instead of the closed form, so
+/// the result is accurate for pure translations. Batches of lines may be
+/// exponentiated with `exp(soa_span<const L>{...}, soa_span<motor<A>>{...})`.
+///
+/// @note Requires `algebra_dimension_v<A> == 4`
+///
+inline constexpr auto exp = detail::exp_fn{};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "rigid_geometric_algebra/detail/derive_soa_overload.hpp"
+#include "rigid_geometric_algebra/detail/geometric_operator.hpp"
+#include "rigid_geometric_algebra/dual.hpp"
+#include "rigid_geometric_algebra/wedge.hpp"
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class expand_value_fn : public detail::geometric_operator
+{
+public:
+  using detail::geometric_operator::operator();
+
+  template <class T1, class T2>
+  static constexpr auto operator()(const T1& a, const T2& b)
+      -> decltype(wedge(a, weight_dual(b)))
+  {
+    return wedge(a, weight_dual(b));
+  }
+};
+
+class expand_fn : public expand_value_fn,
+                  public derive_soa_overload<expand_value_fn>
+{
+public:
+  using expand_value_fn::operator();
+  using derive_soa_overload<expand_value_fn>::operator();
+};
+
+}  // namespace detail
+
+/// weight expansion
+///
+/// Returns `wedge(a, weight_dual(b))`, the element containing `a` that is
+/// orthogonal to `b`. For example, the expansion of a point onto a plane is
+/// the line through the point perpendicular to the plane.
+///
+/// Batches may be expanded with `expand(as, bs, out)` or, onto a single
+/// element, with `expand(as, b, out)`, where `as`, `bs`, and `out` are
+/// `soa_span`s.
+///
+/// @see project
+///
+inline constexpr auto expand = detail::expand_fn{};
+
+}  // namespace rigid_geometric_algebra
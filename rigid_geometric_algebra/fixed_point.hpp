@@ -0,0 +1,343 @@
+#pragma once
+
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/field_identity.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+namespace rigid_geometric_algebra {
+
+/// behavior of fixed-point operations with results outside the representable
+/// range
+///
+enum class overflow_policy
+{
+  /// results are clamped to the smallest or largest representable value
+  saturate,
+  /// results are reduced modulo 2^64, as with unsigned integers
+  wrap,
+};
+
+namespace detail {
+
+// GCC warns about `__int128` with `-Wpedantic` unless marked as an extension
+// NOLINTBEGIN(modernize-use-using)
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+// NOLINTEND(modernize-use-using)
+
+}  // namespace detail
+
+/// signed Q-format fixed-point number
+/// @tparam Fraction number of fractional bits
+/// @tparam Policy behavior on overflow
+///
+/// A `fixed_point` value is stored as a 64-bit integer `raw()` and represents
+/// `raw() / 2^Fraction`. All operations, including the elementary functions
+/// `sqrt`, `sin`, `cos`, and `atan2`, are evaluated with integer arithmetic
+/// only. Results are therefore bit-identical on all platforms and do not
+/// depend on compiler flags such as floating-point contraction.
+///
+/// Sums and products are computed with 128-bit intermediates and then
+/// narrowed to 64 bits according to `Policy`. Products are rounded to
+/// nearest, with ties rounded up. Quotients and square roots are truncated.
+///
+/// Conversion from a floating-point value rounds to nearest and always
+/// saturates.
+///
+/// `fixed_point` models `field` and can be used as the field type of an
+/// `algebra`. The line invariant is not checked for `fixed_point` values as
+/// the inner product of direction and moment is generally not exactly zero.
+///
+template <int Fraction, overflow_policy Policy = overflow_policy::saturate>
+  requires (0 < Fraction) and (Fraction < 62)
+class fixed_point
+{
+  using int128_t = detail::int128_t;
+  using limits = std::numeric_limits<std::int64_t>;
+
+  std::int64_t raw_{};
+
+  static constexpr auto one = int128_t{1} << Fraction;
+
+  // pi in Q62, rounded to nearest
+  static constexpr auto pi_q62 = detail::uint128_t{0xC90FDAA22168C235};
+
+  static constexpr auto pi_raw = static_cast<int128_t>(
+      (pi_q62 + (detail::uint128_t{1} << (61 - Fraction))) >>
+      (62 - Fraction));
+
+  static constexpr auto narrow(int128_t value) noexcept -> std::int64_t
+  {
+    if constexpr (Policy == overflow_policy::saturate) {
+      return static_cast<std::int64_t>(
+          std::clamp<int128_t>(value, limits::min(), limits::max()));
+    } else {
+      return static_cast<std::int64_t>(static_cast<std::uint64_t>(value));
+    }
+  }
+
+  static constexpr auto narrowed(int128_t value) noexcept -> fixed_point
+  {
+    auto x = fixed_point{};
+    x.raw_ = narrow(value);
+    return x;
+  }
+
+  // sin of `x / 2^Fraction`
+  static constexpr auto sine(int128_t x) noexcept -> fixed_point
+  {
+    // reduce to [-pi, pi] and then to [-pi/2, pi/2]
+    x %= 2 * pi_raw;
+    if (x > pi_raw) {
+      x -= 2 * pi_raw;
+    } else if (x < -pi_raw) {
+      x += 2 * pi_raw;
+    }
+    if (x > pi_raw / 2) {
+      x = pi_raw - x;
+    } else if (x < -pi_raw / 2) {
+      x = -pi_raw - x;
+    }
+
+    // x - x^3/3! + x^5/5! - ...
+    const auto y = narrowed(x);
+    const auto y2 = y * y;
+    auto term = y;
+    auto sum = y;
+    for (auto k = 1; term != fixed_point{}; ++k) {
+      term = -narrowed((term * y2).raw_ / ((2 * k) * (2 * k + 1)));
+      sum = sum + term;
+    }
+    return sum;
+  }
+
+  // atan of `t` in [0, 1]
+  static constexpr auto arctangent(fixed_point t) noexcept -> fixed_point
+  {
+    // apply atan(t) = 2 atan(t / (1 + sqrt(1 + t^2))) twice so that the
+    // series converges quickly
+    for (auto i = 0; i != 2; ++i) {
+      t = t / (fixed_point{1} + sqrt(fixed_point{1} + t * t));
+    }
+
+    // t - t^3/3 + t^5/5 - ...
+    const auto t2 = t * t;
+    auto power = t;
+    auto sum = fixed_point{};
+    for (auto k = 0; power != fixed_point{}; ++k) {
+      const auto term = narrowed(power.raw_ / (2 * k + 1));
+      sum = (k % 2 == 0) ? sum + term : sum - term;
+      power = power * t2;
+    }
+    return narrowed(int128_t{sum.raw_} * 4);
+  }
+
+public:
+  /// number of fractional bits
+  ///
+  static constexpr auto fraction = Fraction;
+
+  /// overflow behavior
+  ///
+  static constexpr auto policy = Policy;
+
+  /// constructs zero
+  ///
+  fixed_point() = default;
+
+  /// constructs a value from an integer
+  ///
+  template <std::integral I>
+  constexpr fixed_point(I value) noexcept
+      : raw_{narrow(static_cast<int128_t>(value) * one)}
+  {}
+
+  /// constructs a value from a floating-point value
+  ///
+  /// @pre `value` is not NaN
+  ///
+  template <std::floating_point T>
+  constexpr explicit fixed_point(T value)
+  {
+    detail::precondition(not std::isnan(value));
+
+    const auto scaled = std::round(std::ldexp(value, Fraction));
+    raw_ = (scaled >= T{0x1p63})   ? limits::max()
+           : (scaled < T{-0x1p63}) ? limits::min()
+                                   : static_cast<std::int64_t>(scaled);
+  }
+
+  /// constructs a value from its integer representation
+  ///
+  [[nodiscard]]
+  static constexpr auto from_raw(std::int64_t value) noexcept -> fixed_point
+  {
+    return narrowed(value);
+  }
+
+  /// integer representation, the value multiplied by `2^Fraction`
+  ///
+  [[nodiscard]]
+  constexpr auto raw() const noexcept -> std::int64_t
+  {
+    return raw_;
+  }
+
+  /// converts to a floating-point value
+  ///
+  template <std::floating_point T>
+  constexpr explicit operator T() const noexcept
+  {
+    return std::ldexp(static_cast<T>(raw_), -Fraction);
+  }
+
+  /// pi
+  ///
+  [[nodiscard]]
+  static constexpr auto pi() noexcept -> fixed_point
+  {
+    return narrowed(pi_raw);
+  }
+
+  /// arithmetic operations
+  ///
+  /// @{
+
+  friend constexpr auto operator-(const fixed_point& x) noexcept -> fixed_point
+  {
+    return narrowed(-int128_t{x.raw_});
+  }
+
+  friend constexpr auto
+  operator+(const fixed_point& x, const fixed_point& y) noexcept -> fixed_point
+  {
+    return narrowed(int128_t{x.raw_} + y.raw_);
+  }
+
+  friend constexpr auto
+  operator-(const fixed_point& x, const fixed_point& y) noexcept -> fixed_point
+  {
+    return narrowed(int128_t{x.raw_} - y.raw_);
+  }
+
+  friend constexpr auto
+  operator*(const fixed_point& x, const fixed_point& y) noexcept -> fixed_point
+  {
+    const auto product = int128_t{x.raw_} * y.raw_;
+    return narrowed((product + (one >> 1)) >> Fraction);
+  }
+
+  /// @pre `y` is not zero
+  ///
+  friend constexpr auto
+  operator/(const fixed_point& x, const fixed_point& y) -> fixed_point
+  {
+    detail::precondition(y.raw_ != 0, "division by zero");
+
+    return narrowed((int128_t{x.raw_} * one) / y.raw_);
+  }
+
+  /// @}
+
+  /// elementary functions
+  ///
+  /// @{
+
+  friend constexpr auto abs(const fixed_point& x) noexcept -> fixed_point
+  {
+    return x.raw_ < 0 ? -x : x;
+  }
+
+  /// @pre `x` is not negative
+  ///
+  friend constexpr auto sqrt(const fixed_point& x) -> fixed_point
+  {
+    detail::precondition(x.raw_ >= 0, "square root of a negative value");
+
+    // digit-by-digit square root of `raw * 2^Fraction`
+    auto n = static_cast<detail::uint128_t>(x.raw_) << Fraction;
+    auto root = detail::uint128_t{};
+    auto bit = detail::uint128_t{1} << 126;
+    while (bit > n) {
+      bit >>= 2;
+    }
+    while (bit != 0) {
+      if (n >= root + bit) {
+        n -= root + bit;
+        root = (root >> 1) + bit;
+      } else {
+        root >>= 1;
+      }
+      bit >>= 2;
+    }
+    return narrowed(static_cast<int128_t>(root));
+  }
+
+  friend constexpr auto sin(const fixed_point& x) noexcept -> fixed_point
+  {
+    return sine(x.raw_);
+  }
+
+  friend constexpr auto cos(const fixed_point& x) noexcept -> fixed_point
+  {
+    return sine(int128_t{x.raw_} + (pi_raw / 2));
+  }
+
+  friend constexpr auto
+  atan2(const fixed_point& y, const fixed_point& x) noexcept -> fixed_point
+  {
+    if (x.raw_ == 0 and y.raw_ == 0) {
+      return {};
+    }
+
+    const auto ax = x.raw_ < 0 ? -int128_t{x.raw_} : int128_t{x.raw_};
+    const auto ay = y.raw_ < 0 ? -int128_t{y.raw_} : int128_t{y.raw_};
+
+    auto theta =
+        arctangent(narrowed((std::min(ax, ay) * one) / std::max(ax, ay)));
+    if (ay > ax) {
+      theta = narrowed(pi_raw / 2) - theta;
+    }
+    if (x.raw_ < 0) {
+      theta = pi() - theta;
+    }
+    return y.raw_ < 0 ? -theta : theta;
+  }
+
+  /// @}
+
+  /// comparison
+  ///
+  /// @{
+
+  friend auto
+  operator==(const fixed_point&, const fixed_point&) -> bool = default;
+
+  friend auto operator<=>(const fixed_point&, const fixed_point&)
+      -> std::strong_ordering = default;
+
+  /// @}
+};
+
+/// field identity value for fixed-point multiplication
+///
+template <int Fraction, overflow_policy Policy>
+inline constexpr auto
+    field_identity<fixed_point<Fraction, Policy>, std::multiplies<>> =
+        fixed_point<Fraction, Policy>{1};
+
+/// disable line invariant checks for fixed-point numbers
+///
+template <int Fraction, overflow_policy Policy>
+inline constexpr auto disable_line_invariant<fixed_point<Fraction, Policy>> =
+    true;
+
+}  // namespace rigid_geometric_algebra
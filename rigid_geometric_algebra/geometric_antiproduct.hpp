@@ -0,0 +1,50 @@
+#pragma once
+
+#include "rigid_geometric_algebra/complement.hpp"
+#include "rigid_geometric_algebra/detail/dynamic_operator.hpp"
+#include "rigid_geometric_algebra/detail/geometric_operator.hpp"
+#include "rigid_geometric_algebra/detail/linear_operator.hpp"
+#include "rigid_geometric_algebra/geometric_product.hpp"
+#include "rigid_geometric_algebra/is_blade.hpp"
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class geometric_antiproduct_blade_fn
+{
+public:
+  template <detail::blade B1, detail::blade B2>
+  static constexpr auto operator()(const B1& b1, const B2& b2)
+      -> decltype(left_complement(geometric_product(
+          right_complement(b1), right_complement(b2))))
+  {
+    return left_complement(
+        geometric_product(right_complement(b1), right_complement(b2)));
+  }
+};
+
+class geometric_antiproduct_fn
+    : public detail::linear_operator<detail::geometric_antiproduct_blade_fn>,
+      public detail::geometric_operator,
+      public detail::dynamic_operator<cayley_product::geometric_antiproduct>
+{
+public:
+  using detail::linear_operator<
+      detail::geometric_antiproduct_blade_fn>::operator();
+  using detail::geometric_operator::operator();
+  using detail::dynamic_operator<
+      cayley_product::geometric_antiproduct>::operator();
+};
+
+}  // namespace detail
+
+/// geometric antiproduct
+///
+/// The dual of the geometric product, with the unit hypervolume as the
+/// identity element. Rigid motions are applied and composed with the geometric
+/// antiproduct.
+///
+inline constexpr auto geometric_antiproduct =
+    detail::geometric_antiproduct_fn{};
+
+}  // namespace rigid_geometric_algebra
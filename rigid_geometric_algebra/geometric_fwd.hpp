@@ -20,6 +20,10 @@ template <class A>
   requires is_algebra_v<A>
 class plane;
 
+template <class A>
+  requires is_algebra_v<A>
+class motor;
+
 namespace detail {
 
 template <detail::multivector V>
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/blade_type_from.hpp"
+#include "rigid_geometric_algebra/common_algebra_type.hpp"
+#include "rigid_geometric_algebra/detail/dynamic_operator.hpp"
+#include "rigid_geometric_algebra/detail/inversion_count.hpp"
+#include "rigid_geometric_algebra/detail/linear_operator.hpp"
+#include "rigid_geometric_algebra/detail/negate_if_odd.hpp"
+#include "rigid_geometric_algebra/detail/structural_bitset.hpp"
+#include "rigid_geometric_algebra/is_blade.hpp"
+#include "rigid_geometric_algebra/zero_constant_fwd.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class geometric_product_blade_fn
+{
+  // the projective dimension squares to zero
+  template <detail::blade B1, detail::blade B2>
+    requires has_common_algebra_type_v<B1, B2>
+  static constexpr auto non_degenerate_v = [] {
+    return not(std::remove_cvref_t<B1>::dimension_mask &
+               std::remove_cvref_t<B2>::dimension_mask)
+                  .test(0);
+  }();
+
+  template <detail::blade B1, detail::blade B2>
+    requires non_degenerate_v<B1, B2>
+  using sorted_blade_t = decltype([] {
+    using A = common_algebra_type_t<B1, B2>;
+    using mask_type = detail::structural_bitset<algebra_dimension_v<A>>;
+
+    // repeated factors square to one
+    static constexpr auto mask =
+        mask_type{static_cast<typename mask_type::value_type>(
+            std::remove_cvref_t<B1>::dimension_mask.to_unsigned() ^
+            std::remove_cvref_t<B2>::dimension_mask.to_unsigned())};
+
+    return blade_type_from_mask_t<A, mask>{};
+  }());
+
+  // number of swaps of distinct factors needed to sort the concatenated
+  // factors, after which repeated factors are adjacent
+  template <detail::blade B1, detail::blade B2>
+  static constexpr auto num_swaps_v = [] {
+    const auto& d1 = std::remove_cvref_t<B1>::dimensions;
+    const auto& d2 = std::remove_cvref_t<B2>::dimensions;
+
+    auto n = detail::inversion_count(d1) + detail::inversion_count(d2);
+    for (auto i : d1) {
+      for (auto j : d2) {
+        n += std::size_t(i > j);
+      }
+    }
+    return n;
+  }();
+
+public:
+  template <detail::blade B1, detail::blade B2>
+    requires has_common_algebra_type_v<B1, B2> and non_degenerate_v<B1, B2>
+  static constexpr auto operator()(B1&& b1, B2&& b2) ->
+      typename sorted_blade_t<B1, B2>::canonical_type
+  {
+    return sorted_blade_t<B1, B2>{detail::negate_if_odd<num_swaps_v<B1, B2>>{}(
+                                      std::forward<B1>(b1).coefficient *
+                                      std::forward<B2>(b2).coefficient)}
+        .canonical();
+  }
+
+  template <detail::blade B1, detail::blade B2>
+    requires has_common_algebra_type_v<B1, B2> and
+             (not non_degenerate_v<B1, B2>)
+  static constexpr auto operator()(const B1&, const B2&)
+      -> zero_constant<common_algebra_type_t<B1, B2>>
+  {
+    return {};
+  }
+};
+
+class geometric_product_fn
+    : public detail::linear_operator<detail::geometric_product_blade_fn>,
+      public detail::dynamic_operator<cayley_product::geometric_product>
+{
+public:
+  using detail::linear_operator<detail::geometric_product_blade_fn>::operator();
+  using detail::dynamic_operator<
+      cayley_product::geometric_product>::operator();
+};
+
+}  // namespace detail
+
+/// geometric product
+///
+/// The geometric product of two blades is the product of their factors, where
+/// repeated factors contract - `e0 * e0` is zero and `ei * ei` is one for
+/// `i != 0`.
+///
+inline constexpr auto geometric_product = detail::geometric_product_fn{};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/blade_sum.hpp"
+#include "rigid_geometric_algebra/is_algebra.hpp"
+#include "rigid_geometric_algebra/scalar_type.hpp"
+
+#include <type_traits>
+
+namespace rigid_geometric_algebra {
+
+/// homogeneous magnitude type
+/// @tparam A algebra type
+///
+/// A `multivector` with a scalar `s` and an antiscalar `w`, representing the
+/// magnitude `s / w`. Keeping the numerator and denominator separate allows
+/// the division to be deferred, skipped when comparing magnitudes, or
+/// performed for many values at once.
+///
+template <class A>
+  requires is_algebra_v<A>
+using homogeneous_magnitude_t = decltype(blade_sum(
+    std::declval<scalar_type_t<A>>(), std::declval<antiscalar_type_t<A>>()));
+
+/// constructs a homogeneous magnitude
+/// @tparam A algebra type
+/// @param s numerator
+/// @param w denominator
+///
+template <class A>
+  requires is_algebra_v<A>
+constexpr auto homogeneous_magnitude(
+    const algebra_field_t<A>& s,
+    const algebra_field_t<A>& w) -> homogeneous_magnitude_t<A>
+{
+  return blade_sum(scalar_type_t<A>{s}, antiscalar_type_t<A>{w});
+}
+
+}  // namespace rigid_geometric_algebra
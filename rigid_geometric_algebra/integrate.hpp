@@ -0,0 +1,127 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/axpy.hpp"
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/detail/for_each_partition.hpp"
+#include "rigid_geometric_algebra/detail/type_list.hpp"
+#include "rigid_geometric_algebra/exp.hpp"
+#include "rigid_geometric_algebra/geometric_antiproduct.hpp"
+#include "rigid_geometric_algebra/get.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/motor.hpp"
+#include "rigid_geometric_algebra/rigid_body.hpp"
+#include "rigid_geometric_algebra/soa_span.hpp"
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class integrate_fn
+{
+  // commutator of the geometric antiproduct, restricted to bivectors
+  template <class V>
+  static constexpr auto commutator(const V& x, const V& y) -> V
+  {
+    const auto c = geometric_antiproduct(x, y) - geometric_antiproduct(y, x);
+
+    return [&c]<class... Bs>(detail::type_list<Bs...>) {
+      return V{get<Bs>(c)...};
+    }(typename V::blade_list_type{});
+  }
+
+public:
+  template <class A>
+  static auto operator()(
+      const rigid_body<A>& body,
+      const typename rigid_body<A>::bivector_type& forque,
+      const rigid_body_inertia<A>& inertia,
+      const algebra_field_t<A>& dt) -> rigid_body<A>
+  {
+    using T = algebra_field_t<A>;
+    const auto half = T{1} / T{2};
+
+    const auto momentum = inertia.momentum(body.velocity);
+    const auto velocity = axpy(
+        dt,
+        inertia.velocity(forque - half * commutator(body.velocity, momentum)),
+        body.velocity);
+
+    return {
+        .pose = geometric_antiproduct(body.pose, exp((half * dt) * velocity)),
+        .velocity = velocity};
+  }
+
+  template <class A>
+  static auto operator()(
+      soa_span<motor<A>> poses,
+      soa_span<typename rigid_body<A>::bivector_type> velocities,
+      soa_span<const typename rigid_body<A>::bivector_type> forques,
+      std::span<const rigid_body_inertia<std::type_identity_t<A>>> inertias,
+      const algebra_field_t<A>& dt,
+      std::size_t thread_count = 1) -> void
+  {
+    detail::precondition(velocities.size() == poses.size());
+    detail::precondition(forques.size() == poses.size());
+    detail::precondition(inertias.size() == poses.size());
+
+    detail::for_each_partition(
+        poses.size(),
+        thread_count,
+        [=](std::size_t offset, std::size_t count) {
+          const auto q = poses.subspan(offset, count);
+          const auto b = velocities.subspan(offset, count);
+          const auto f = forques.subspan(offset, count);
+          const auto m = inertias.subspan(offset, count);
+
+          for (auto i = 0UZ; i != count; ++i) {
+            const auto body =
+                integrate_fn{}(rigid_body<A>{q[i], b[i]}, f[i], m[i], dt);
+            q.store(i, body.pose);
+            b.store(i, body.velocity);
+          }
+        });
+  }
+};
+
+}  // namespace detail
+
+/// advances the state of a rigid body
+/// @param body rigid body state
+/// @param forque net forque acting on the body, in body coordinates
+/// @param inertia mass properties of the body
+/// @param dt time step
+///
+/// Integrates the equations of motion of a rigid body
+/// ```
+/// d/dt pose = 1/2 geometric_antiproduct(pose, B)
+/// d/dt I[B] = F - 1/2 (geometric_antiproduct(B, I[B]) -
+///                      geometric_antiproduct(I[B], B))
+/// ```
+/// where `B` is the velocity, `I` is the inertia, and `F` is the forque. The
+/// semi-implicit Euler method first updates the velocity and then updates the
+/// pose with the motor `exp(dt/2 B)`. The updated pose is a unit motor if the
+/// initial pose is.
+///
+/// A forque `F` in world coordinates is transformed to body coordinates with
+/// ```
+/// geometric_antiproduct(geometric_antiproduct(antireverse(pose), F), pose)
+/// ```
+///
+/// Batches of bodies may be advanced in place with
+/// ```
+/// integrate(poses, velocities, forques, inertias, dt, thread_count)
+/// ```
+/// where `poses`, `velocities`, and `forques` are `soa_span`s, `inertias` is a
+/// `std::span`, and the bodies are partitioned as described by
+/// `detail::for_each_partition`.
+///
+/// @see rigid_body
+/// @see rigid_body_inertia
+///
+inline constexpr auto integrate = detail::integrate_fn{};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/exp.hpp"
+#include "rigid_geometric_algebra/geometric_antiproduct.hpp"
+#include "rigid_geometric_algebra/get.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/log.hpp"
+#include "rigid_geometric_algebra/motor.hpp"
+#include "rigid_geometric_algebra/reverse.hpp"
+#include "rigid_geometric_algebra/soa_span.hpp"
+
+#include <cstddef>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class interpolate_fn
+{
+  // logarithm of the motor `d` where `m1 = m0 ⟇ d`
+  //
+  // `d` and `-d` describe the same motion. The sign with a nonnegative
+  // antiscalar is chosen so that interpolation follows the shorter path.
+  template <class A>
+  static auto relative_log(const motor<A>& m0, const motor<A>& m1) ->
+      typename line<A>::multivector_type
+  {
+    using T = algebra_field_t<A>;
+
+    const auto d = geometric_antiproduct(antireverse(m0), m1).multivector();
+    const auto w = get<typename A::template blade<0, 1, 2, 3>>(d).coefficient;
+
+    return log((w < T{} ? T{-1} : T{1}) * d);
+  }
+
+public:
+  template <class A>
+  static auto operator()(
+      const motor<A>& m0,
+      const motor<A>& m1,
+      const algebra_field_t<A>& t) -> motor<A>
+  {
+    return geometric_antiproduct(m0, exp(t * relative_log(m0, m1)));
+  }
+
+  template <class A>
+  static auto
+  operator()(soa_span<const motor<A>> keys, soa_span<motor<A>> samples)
+      -> void
+  {
+    using T = algebra_field_t<A>;
+
+    const auto n = samples.size();
+    const auto k = keys.size();
+
+    detail::precondition(n == 0 or k != 0, [n] {
+      return detail::contract_violation_handler{
+          "cannot resample {} samples from an empty track", n};
+    });
+
+    if (n == 0) {
+      return;
+    }
+
+    if (k == 1 or n == 1) {
+      for (auto j = 0UZ; j != n; ++j) {
+        samples.store(j, keys[0]);
+      }
+      return;
+    }
+
+    // sample `j` lies at `j * (k - 1) / (n - 1)` in units of key intervals.
+    // integer arithmetic determines the samples in each segment exactly.
+    const auto scale = T{1} / static_cast<T>(n - 1);
+
+    auto j = 0UZ;
+    for (auto s = 0UZ; s != k - 1; ++s) {
+      const auto m0 = keys[s];
+      const auto l = relative_log(m0, keys[s + 1]);
+
+      const auto end =
+          (s + 2 == k) ? n : ((s + 1) * (n - 1) + (k - 2)) / (k - 1);
+
+      for (; j != end; ++j) {
+        const auto t =
+            static_cast<T>(j * (k - 1) - s * (n - 1)) * scale;
+        samples.store(j, geometric_antiproduct(m0, exp(t * l)));
+      }
+    }
+  }
+};
+
+}  // namespace detail
+
+/// screw-linear interpolation of motors
+/// @param m0, m1 unit motors
+/// @param t interpolation parameter
+///
+/// Returns the motor
+/// ```
+/// geometric_antiproduct(m0, exp(t log(d)))
+/// ```
+/// where `d` is the unit motor such that `m1 = geometric_antiproduct(m0, d)`.
+/// The result moves along a screw from `m0` at `t = 0` to `m1` at `t = 1`,
+/// combining a constant-rate rotation with a constant-rate translation along
+/// the same axis. Of the two motors `d` and `-d`, which describe the same
+/// motion, the one describing the shorter path is used.
+///
+/// A keyframe track may be resampled at a different rate with
+/// ```
+/// interpolate(keys, samples)
+/// ```
+/// where `keys` and `samples` are `soa_span`s of motors. Keys and samples are
+/// both uniformly spaced in time, and the first and last samples coincide with
+/// the first and last keys. The logarithm is evaluated once for each pair of
+/// adjacent keys and reused for every sample between them.
+///
+/// @pre `samples` is empty or `keys` is not empty
+/// @note Requires `algebra_dimension_v<A> == 4`
+///
+inline constexpr auto interpolate = detail::interpolate_fn{};
+
+}  // namespace rigid_geometric_algebra
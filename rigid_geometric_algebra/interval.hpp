@@ -0,0 +1,250 @@
+#pragma once
+
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/field_identity.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <format>
+#include <functional>
+#include <limits>
+#include <utility>
+
+namespace rigid_geometric_algebra {
+
+/// closed interval of floating-point values
+/// @tparam T floating-point type
+///
+/// An `interval` encloses the exact result of a computation. Each operation
+/// evaluates its bounds with round-to-nearest and, if a bound is inexact,
+/// moves it outward by one unit in the last place. The interval then contains
+/// the exact result of the operation applied to any values within the operand
+/// intervals. The enclosure stays valid through overflow and underflow.
+///
+/// Bounds are only moved if rounding occurred, so a computation that is exact
+/// in `T` results in an interval containing a single value.
+///
+/// Division by an interval containing zero results in the entire real line.
+///
+/// `interval` models `field` and can be used as the field type of an
+/// `algebra`. The line invariant is not checked for `interval` values as
+/// the inner product of direction and moment is generally not exactly zero.
+///
+template <std::floating_point T>
+class interval
+{
+  T lower_{};
+  T upper_{};
+
+  static constexpr auto inf = std::numeric_limits<T>::infinity();
+
+  // bounds from rounded values and the signs of their rounding errors
+  //
+  // the rounding error `exact - rounded` is NaN if it is not known
+  static constexpr auto
+  widen(T lower, T lower_error, T upper, T upper_error) -> interval
+  {
+    auto result = interval{};
+    result.lower_ =
+        lower_error >= T{} ? lower : std::nextafter(lower, -inf);
+    result.upper_ = upper_error <= T{} ? upper : std::nextafter(upper, inf);
+    return result;
+  }
+
+  static constexpr auto sum_error(T x, T y, T sum) -> T
+  {
+    const auto y_rounded = sum - x;
+    return (x - (sum - y_rounded)) + (y - y_rounded);
+  }
+
+  static constexpr auto product_error(T x, T y, T product) -> T
+  {
+    // the error is exact unless it may underflow
+    using limits = std::numeric_limits<T>;
+    if (product == T{}) {
+      return (x == T{} or y == T{}) ? T{} : limits::quiet_NaN();
+    }
+    if (std::abs(product) < limits::min() / limits::epsilon()) {
+      return limits::quiet_NaN();
+    }
+    return std::fma(x, y, -product);
+  }
+
+  static constexpr auto quotient_error(T x, T y, T quotient) -> T
+  {
+    // the residual `x - quotient y` is exact unless it may underflow
+    using limits = std::numeric_limits<T>;
+    if (x == T{}) {
+      return T{};
+    }
+    if (std::abs(quotient) < limits::min() or
+        std::abs(x) < limits::min() / limits::epsilon() or
+        std::isinf(quotient)) {
+      return limits::quiet_NaN();
+    }
+    const auto residual = std::fma(-quotient, y, x);
+    return y < T{} ? -residual : residual;
+  }
+
+  template <class F>
+  static constexpr auto hull(const interval& x, const interval& y, F f)
+      -> interval
+  {
+    auto result = interval{inf};
+    result.upper_ = -inf;
+    for (auto a : {x.lower_, x.upper_}) {
+      for (auto b : {y.lower_, y.upper_}) {
+        const auto [value, error] = f(a, b);
+        const auto bound = widen(value, error, value, error);
+        result.lower_ = std::min(result.lower_, bound.lower_);
+        result.upper_ = std::max(result.upper_, bound.upper_);
+      }
+    }
+    return result;
+  }
+
+public:
+  /// constructs the interval containing only zero
+  ///
+  interval() = default;
+
+  /// constructs an interval containing a single value
+  ///
+  constexpr interval(T value) noexcept : lower_{value}, upper_{value} {}
+
+  /// constructs an interval from its bounds
+  ///
+  /// @pre `lower <= upper`
+  ///
+  constexpr interval(T lower, T upper) : lower_{lower}, upper_{upper}
+  {
+    detail::precondition(lower <= upper, [lower, upper] {
+      return detail::contract_violation_handler{
+          "lower bound '{}' must not exceed upper bound '{}'", lower, upper};
+    });
+  }
+
+  /// lower bound
+  ///
+  [[nodiscard]]
+  constexpr auto lower() const noexcept -> T
+  {
+    return lower_;
+  }
+
+  /// upper bound
+  ///
+  [[nodiscard]]
+  constexpr auto upper() const noexcept -> T
+  {
+    return upper_;
+  }
+
+  /// checks if the interval contains a value
+  ///
+  [[nodiscard]]
+  constexpr auto contains(T value) const noexcept -> bool
+  {
+    return lower_ <= value and value <= upper_;
+  }
+
+  /// arithmetic operations
+  ///
+  /// @{
+
+  friend constexpr auto operator-(const interval& x) noexcept -> interval
+  {
+    auto result = interval{};
+    result.lower_ = -x.upper_;
+    result.upper_ = -x.lower_;
+    return result;
+  }
+
+  friend constexpr auto
+  operator+(const interval& x, const interval& y) -> interval
+  {
+    const auto lower = x.lower_ + y.lower_;
+    const auto upper = x.upper_ + y.upper_;
+    return widen(
+        lower,
+        sum_error(x.lower_, y.lower_, lower),
+        upper,
+        sum_error(x.upper_, y.upper_, upper));
+  }
+
+  friend constexpr auto
+  operator-(const interval& x, const interval& y) -> interval
+  {
+    return x + -y;
+  }
+
+  friend constexpr auto
+  operator*(const interval& x, const interval& y) -> interval
+  {
+    return hull(x, y, [](T a, T b) {
+      const auto product = a * b;
+      return std::pair{product, product_error(a, b, product)};
+    });
+  }
+
+  friend constexpr auto
+  operator/(const interval& x, const interval& y) -> interval
+  {
+    if (y.contains(T{})) {
+      auto result = interval{-inf};
+      result.upper_ = inf;
+      return result;
+    }
+
+    return hull(x, y, [](T a, T b) {
+      const auto quotient = a / b;
+      return std::pair{quotient, quotient_error(a, b, quotient)};
+    });
+  }
+
+  /// @}
+
+  /// equality comparison
+  ///
+  /// Intervals are equal if they have the same bounds.
+  ///
+  friend auto
+  operator==(const interval&, const interval&) -> bool = default;
+};
+
+/// field identity value for interval multiplication
+///
+template <class T>
+inline constexpr auto field_identity<interval<T>, std::multiplies<>> =
+    interval<T>{T{1}};
+
+/// disable line invariant checks for intervals
+///
+template <class T>
+inline constexpr auto disable_line_invariant<interval<T>> = true;
+
+}  // namespace rigid_geometric_algebra
+
+template <class T, class Char>
+struct std::formatter<::rigid_geometric_algebra::interval<T>, Char>
+    : std::formatter<T, Char>
+{
+  template <class O>
+  constexpr auto format(
+      const ::rigid_geometric_algebra::interval<T>& x,
+      std::basic_format_context<O, Char>& ctx) const -> O
+  {
+    auto out = ctx.out();
+    *out++ = Char{'['};
+    ctx.advance_to(out);
+    out = std::formatter<T, Char>::format(x.lower(), ctx);
+    *out++ = Char{','};
+    *out++ = Char{' '};
+    ctx.advance_to(out);
+    out = std::formatter<T, Char>::format(x.upper(), ctx);
+    *out++ = Char{']'};
+    return out;
+  }
+};
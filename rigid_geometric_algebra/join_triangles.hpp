@@ -0,0 +1,147 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/detail/for_each_partition.hpp"
+#include "rigid_geometric_algebra/detail/type_list.hpp"
+#include "rigid_geometric_algebra/plane.hpp"
+#include "rigid_geometric_algebra/point.hpp"
+#include "rigid_geometric_algebra/soa_span.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class join_triangles_fn
+{
+  template <class T>
+  using columns_type = std::array<T*, 4>;
+
+  // coefficients of `wedge(wedge(p, q), r)` for the points with indices
+  // `i0`, `i1`, and `i2`
+  //
+  // The coefficient of a plane blade with dimensions `(a, b, c)` is the
+  // determinant of columns `a`, `b`, and `c` of the matrix with rows `p`,
+  // `q`, and `r`. Determinants are expanded along `p` so that the 2x2 minors
+  // of `q` and `r` are computed once and shared by all coefficients.
+  template <class T, std::size_t... Is, class... Bs>
+  static constexpr auto join(
+      const columns_type<const T>& v,
+      std::size_t i0,
+      std::size_t i1,
+      std::size_t i2,
+      const columns_type<T>& out,
+      std::size_t i,
+      std::index_sequence<Is...>,
+      detail::type_list<Bs...>) -> void
+  {
+    const auto p = std::array{v[0][i0], v[1][i0], v[2][i0], v[3][i0]};
+    const auto q = std::array{v[0][i1], v[1][i1], v[2][i1], v[3][i1]};
+    const auto r = std::array{v[0][i2], v[1][i2], v[2][i2], v[3][i2]};
+
+    auto minor = std::array<std::array<T, 4>, 4>{};
+    for (auto a = 0UZ; a != 4; ++a) {
+      for (auto b = a + 1; b != 4; ++b) {
+        minor[a][b] = q[a] * r[b] - q[b] * r[a];
+        minor[b][a] = -minor[a][b];
+      }
+    }
+
+    const auto det = [&p, &minor](const auto& d) {
+      return p[d[0]] * minor[d[1]][d[2]] - p[d[1]] * minor[d[0]][d[2]] +
+             p[d[2]] * minor[d[0]][d[1]];
+    };
+
+    ((out[Is][i] = det(Bs::dimensions)), ...);
+  }
+
+public:
+  template <class P, std::unsigned_integral I>
+    requires std::same_as<
+                 std::remove_const_t<P>,
+                 point<algebra_type_t<P>>> and
+             (algebra_dimension_v<algebra_type_t<P>> == 4)
+  static auto operator()(
+      soa_span<P> vertices,
+      std::span<const I> indices,
+      soa_span<plane<algebra_type_t<P>>> planes,
+      std::size_t thread_count = 1) -> void
+  {
+    using A = algebra_type_t<P>;
+    using T = algebra_field_t<A>;
+
+    detail::precondition(
+        indices.size() == 3 * planes.size(), [n = indices.size()] {
+          return detail::contract_violation_handler{
+              "number of indices '{}' must be 3 times the number of planes",
+              n};
+        });
+
+    const auto v = soa_span<const point<A>>{vertices}.data();
+
+    detail::for_each_partition(
+        planes.size(),
+        thread_count,
+        [=](std::size_t offset, std::size_t count) {
+          const auto idx = indices.subspan(3 * offset, 3 * count);
+
+          // checked before the loop, see `for_each_partition`
+          detail::precondition(
+              idx.empty() or
+                  std::ranges::max(idx) < vertices.size(),
+              [n = vertices.size()] {
+                return detail::contract_violation_handler{
+                    "vertex index must be less than '{}'", n};
+              });
+
+          const auto out = planes.subspan(offset, count).data();
+
+          for (auto i = 0UZ; i != count; ++i) {
+            join<T>(
+                v,
+                std::size_t{idx[3 * i]},
+                std::size_t{idx[3 * i + 1]},
+                std::size_t{idx[3 * i + 2]},
+                out,
+                i,
+                std::make_index_sequence<4>{},
+                typename plane<A>::multivector_type::blade_list_type{});
+          }
+        });
+  }
+};
+
+}  // namespace detail
+
+/// planes through the triangles of an indexed mesh
+/// @param vertices mesh vertices
+/// @param indices vertex indices, three for each triangle
+/// @param planes output planes, one for each triangle
+/// @param thread_count maximum number of threads
+///
+/// Stores `wedge(wedge(p0, p1), p2)` in `planes` for each triangle with
+/// vertices `p0`, `p1`, and `p2`. `vertices` and `planes` are `soa_span`s and
+/// `indices` is a `std::span` of an unsigned integer type, as commonly used
+/// for index buffers.
+///
+/// The intermediate line `wedge(p0, p1)` is not formed. Instead, each plane
+/// coefficient is computed directly from the vertex coefficients with the
+/// 2x2 minors of `p1` and `p2` shared between coefficients, and each
+/// coefficient is stored to its own array. Triangles are partitioned as
+/// described by `detail::for_each_partition`.
+///
+/// @pre `indices.size() == 3 * planes.size()`
+/// @pre each index is less than `vertices.size()`
+///
+inline constexpr auto join_triangles = detail::join_triangles_fn{};
+
+}  // namespace rigid_geometric_algebra
@@ -85,11 +85,13 @@ private:
                     direction.end(),
                     moment.begin(),
                     value_type{}),
-        detail::contract_violation_handler{
-            "the `direction` and `moment` components of a line must be "
-            "perpendicular:\ndirection: {}\nmoment: {}",
-            direction,
-            moment});
+        [direction, moment] {
+          return detail::contract_violation_handler{
+              "the `direction` and `moment` components of a line must be "
+              "perpendicular:\ndirection: {}\nmoment: {}",
+              direction,
+              moment};
+        });
   }
 
 public:
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/blade_sum.hpp"
+#include "rigid_geometric_algebra/detail/derive_soa_overload.hpp"
+#include "rigid_geometric_algebra/detail/screw_factors.hpp"
+#include "rigid_geometric_algebra/get.hpp"
+#include "rigid_geometric_algebra/is_multivector.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/motor.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class log_value_fn
+{
+public:
+  template <detail::multivector V, class A = algebra_type_t<V>>
+    requires (algebra_dimension_v<A> == 4) and
+             std::is_same_v<
+                 std::remove_cvref_t<V>,
+                 typename motor<A>::multivector_type>
+  static auto operator()(const V& q) -> typename line<A>::multivector_type
+  {
+    using T = algebra_field_t<A>;
+    using std::atan2;
+    using std::sqrt;
+
+    const auto& s = get<typename A::template blade<>>(q).coefficient;
+    const auto& rx = get<typename A::template blade<0, 1>>(q).coefficient;
+    const auto& ry = get<typename A::template blade<0, 2>>(q).coefficient;
+    const auto& rz = get<typename A::template blade<0, 3>>(q).coefficient;
+    const auto& ux = get<typename A::template blade<2, 3>>(q).coefficient;
+    const auto& uy = get<typename A::template blade<3, 1>>(q).coefficient;
+    const auto& uz = get<typename A::template blade<1, 2>>(q).coefficient;
+    const auto& w = get<typename A::template blade<0, 1, 2, 3>>(q).coefficient;
+
+    const auto f = screw_factors<T>::from_angle(
+        atan2(sqrt(rx * rx + ry * ry + rz * rz), w));
+    const auto inv_sinc = T{1} / f.sinc;
+
+    const auto vx = rx * inv_sinc;
+    const auto vy = ry * inv_sinc;
+    const auto vz = rz * inv_sinc;
+    const auto k = s * inv_sinc * f.dsinc;
+
+    return blade_sum(
+        typename A::template blade<0, 1>{vx},
+        typename A::template blade<0, 2>{vy},
+        typename A::template blade<0, 3>{vz},
+        typename A::template blade<2, 3>{(ux - k * vx) * inv_sinc},
+        typename A::template blade<3, 1>{(uy - k * vy) * inv_sinc},
+        typename A::template blade<1, 2>{(uz - k * vz) * inv_sinc});
+  }
+
+  template <class A>
+  static auto operator()(const motor<A>& q)
+      -> decltype(operator()(q.multivector()))
+  {
+    return operator()(q.multivector());
+  }
+};
+
+class log_fn : public log_value_fn, public derive_soa_overload<log_value_fn>
+{
+public:
+  using log_value_fn::operator();
+  using derive_soa_overload<log_value_fn>::operator();
+};
+
+}  // namespace detail
+
+/// logarithm of a motor
+/// @param q unit motor or its `multivector`
+///
+/// Returns the bivector `multivector` `l` such that `exp(l) == q`, choosing
+/// the rotation angle `2|v|` in `[0, 2π)`, where `v` is the direction of `l`.
+///
+/// The result is a line only if the motor has no translation along its axis.
+/// In general, it is a screw - the sum of a line and a line at infinity - and
+/// is returned as a `multivector`.
+///
+/// Small rotation angles use Taylor polynomials instead of the closed form,
+/// so the result is accurate for pure translations. Batches of motors may be
+/// logarithmized with
+/// `log(soa_span<const motor<A>>{...}, soa_span<M>{...})`.
+///
+/// @pre `q` is unitized
+/// @pre the rotation angle of `q` is not `2π`
+/// @note Requires `algebra_dimension_v<A> == 4`
+///
+inline constexpr auto log = detail::log_fn{};
+
+}  // namespace rigid_geometric_algebra
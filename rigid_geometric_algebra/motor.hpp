@@ -0,0 +1,97 @@
+#pragma once
+
+#include "rigid_geometric_algebra/detail/geometric_interface.hpp"
+#include "rigid_geometric_algebra/geometric_antiproduct.hpp"
+#include "rigid_geometric_algebra/glz_fwd.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/to_multivector.hpp"
+#include "rigid_geometric_algebra/unit_hypervolume.hpp"
+
+#include <format>
+#include <type_traits>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+template <class A>
+  requires is_algebra_v<A>
+using motor_multivector_type_t = std::invoke_result_t<
+    decltype(geometric_antiproduct),
+    typename line<A>::multivector_type,
+    typename line<A>::multivector_type>;
+
+}  // namespace detail
+
+/// rigid motion
+/// @tparam A algebra type
+///
+/// A motor is the geometric antiproduct of two lines and contains the elements
+/// of even antigrade. A unit motor `Q` applies a rotation about a line
+/// combined with a translation along that line, transforming an element `x`
+/// with the sandwich product:
+/// ```
+/// geometric_antiproduct(geometric_antiproduct(Q, x), antireverse(Q))
+/// ```
+///
+template <class A>
+  requires is_algebra_v<A>
+class motor
+    : public detail::geometric_interface<detail::motor_multivector_type_t<A>>
+{
+  static_assert(algebra_dimension_v<A> > 2);
+
+  using base_type =
+      detail::geometric_interface<detail::motor_multivector_type_t<A>>;
+
+public:
+  /// algebra type
+  ///
+  using algebra_type = typename base_type::algebra_type;
+
+  /// blade scalar type
+  ///
+  using value_type = typename base_type::value_type;
+
+  /// multivector type
+  ///
+  using multivector_type = typename base_type::multivector_type;
+
+  /// default geometric type constructors
+  ///
+  using base_type::base_type;
+
+  /// obtains the identity motor
+  ///
+  /// Returns the motor with only the unit hypervolume, the identity element of
+  /// the geometric antiproduct.
+  ///
+  static constexpr auto identity() -> motor
+  {
+    return motor{
+        multivector_type{to_multivector(unit_hypervolume<algebra_type>)}};
+  }
+
+  /// equality comparison
+  ///
+  /// @{
+
+  friend auto operator==(const motor&, const motor&) -> bool = default;
+
+  /// @}
+};
+
+}  // namespace rigid_geometric_algebra
+
+template <class A, class Char>
+struct ::std::formatter<::rigid_geometric_algebra::motor<A>, Char>
+    : ::std::formatter<
+          ::rigid_geometric_algebra::detail::geometric_interface<
+              typename ::rigid_geometric_algebra::motor<A>::multivector_type>,
+          Char>
+{};
+
+template <class A>
+struct ::glz::meta<::rigid_geometric_algebra::motor<A>>
+    : ::glz::meta<::rigid_geometric_algebra::detail::geometric_interface<
+          typename ::rigid_geometric_algebra::motor<A>::multivector_type>>
+{};
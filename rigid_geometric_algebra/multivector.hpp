@@ -6,13 +6,13 @@
 #include "rigid_geometric_algebra/blade_ordering.hpp"
 #include "rigid_geometric_algebra/blade_type_from.hpp"
 #include "rigid_geometric_algebra/common_algebra_type.hpp"
+#include "rigid_geometric_algebra/detail/blade_storage.hpp"
 #include "rigid_geometric_algebra/detail/copy_ref_qual.hpp"
 #include "rigid_geometric_algebra/detail/decays_to.hpp"
 #include "rigid_geometric_algebra/detail/derive_subtraction.hpp"
 #include "rigid_geometric_algebra/detail/derive_vector_space_operations.hpp"
 #include "rigid_geometric_algebra/detail/multivector_promotable.hpp"
 #include "rigid_geometric_algebra/detail/multivector_sum.hpp"
-#include "rigid_geometric_algebra/detail/rebind_args_into.hpp"
 #include "rigid_geometric_algebra/detail/size_checked_subrange.hpp"
 #include "rigid_geometric_algebra/detail/type_list.hpp"
 #include "rigid_geometric_algebra/get.hpp"
@@ -23,6 +23,7 @@
 #include "rigid_geometric_algebra/to_multivector.hpp"
 #include "rigid_geometric_algebra/wedge.hpp"
 
+#include <algorithm>
 #include <array>
 #include <concepts>
 #include <cstddef>
@@ -44,8 +45,7 @@ namespace rigid_geometric_algebra {
 template <class A, blade_dimensions... D>
   requires is_algebra_v<A>
 class multivector
-    : std::tuple<blade_type_from_dimensions_t<A, D>...>,
-      detail::derive_vector_space_operations<
+    : detail::derive_vector_space_operations<
           multivector<A, D...>,
           detail::get_fn<blade_type_from_dimensions_t<A, D>>...>,
       detail::derive_subtraction<multivector<A, D...>>
@@ -53,7 +53,32 @@ class multivector
   static_assert(
       is_canonical_blade_order<blade_type_from_dimensions_t<A, D>...>());
 
-  using base_type = std::tuple<blade_type_from_dimensions_t<A, D>...>;
+  using storage_type =
+      detail::blade_storage<blade_type_from_dimensions_t<A, D>...>;
+
+  storage_type blades_{};
+
+  static_assert(
+      sizeof...(D) == 0 or
+          sizeof(storage_type) ==
+              sizeof...(D) * sizeof(algebra_field_t<A>),
+      "blades must be stored without padding");
+
+  // element type of the tuple returned by `as_tuple`, a reference for an
+  // lvalue `Self` and a value otherwise
+  template <class Self, class B>
+  using tuple_element_type = std::conditional_t<
+      std::is_lvalue_reference_v<Self>,
+      detail::copy_ref_qual_t<Self, B>,
+      B>;
+
+  template <class B>
+  static constexpr auto index_of = [] {
+    constexpr auto same =
+        std::array{std::is_same_v<B, blade_type_from_dimensions_t<A, D>>...};
+    const auto it = std::ranges::find(same, true);
+    return static_cast<std::size_t>(it - same.begin());
+  }();
 
   struct blade_set : blade_type_from_dimensions_t<A, D>...
   {};
@@ -89,23 +114,45 @@ public:
   static constexpr auto size =
       std::integral_constant<std::size_t, sizeof...(D)>{};
 
-  /// inherited constructors from std::tuple
-  ///
-  using base_type::base_type;
-
   /// blade list
   ///
   using blade_list_type =
-      detail::rebind_args_into_t<base_type, detail::type_list>;
+      detail::type_list<blade_type_from_dimensions_t<A, D>...>;
+
+  /// constructs a multivector with zero coefficients
+  ///
+  multivector() = default;
+
+  /// constructs a multivector from blades
+  ///
+  constexpr multivector(const blade_type_from_dimensions_t<A, D>&... blades)
+    requires (sizeof...(D) != 0)
+      : blades_{blades...}
+  {}
+
+  /// constructs a multivector, converting each argument to a blade
+  ///
+  template <class... Ts>
+    requires (sizeof...(Ts) == sizeof...(D)) and (sizeof...(D) != 0) and
+             (std::constructible_from<
+                  blade_type_from_dimensions_t<A, D>,
+                  Ts> and
+              ...) and
+             (not(sizeof...(Ts) == 1 and
+                  (detail::decays_to<Ts, multivector> and ...)))
+  constexpr explicit(
+      not(std::convertible_to<Ts, blade_type_from_dimensions_t<A, D>> and ...))
+      multivector(Ts&&... values)
+      : blades_{std::forward<Ts>(values)...}
+  {}
 
   /// non-narrowing construction from a different multivector
   ///
   template <blade_dimensions... D2>
     requires (dimensions_subset<D2...>())
   constexpr explicit multivector(const multivector<algebra_type, D2...>& other)
-      : base_type{[&other]<class... Bs>(detail::type_list<Bs...>) {
-          return base_type{get_or<Bs>(other, Bs{})...};
-        }(blade_list_type{})}
+      : blades_{get_or<blade_type_from_dimensions_t<A, D>>(
+            other, blade_type_from_dimensions_t<A, D>{})...}
   {}
 
   /// initializer list constructor
@@ -118,9 +165,9 @@ public:
   ///
   constexpr multivector(std::initializer_list<value_type> il)
     requires std::floating_point<value_type>
-      : base_type{
+      : blades_{
             []<std::size_t... Is>(std::index_sequence<Is...>, auto values) {
-              return base_type{values[Is]...};
+              return storage_type{values[Is]...};
             }(std::make_index_sequence<size>{},
               detail::size_checked_subrange<size>(il))}
   {}
@@ -130,14 +177,30 @@ public:
   template <class B>
   static constexpr auto contains = std::is_base_of_v<B, blade_set>;
 
-  /// access the underlying tuple
+  /// tuple of the blades
+  ///
+  /// Returns references to the blades of an lvalue and, so that the result
+  /// does not dangle, blades moved from an rvalue.
   ///
   template <class Self>
-  constexpr auto
-  as_tuple(this Self&& self) -> detail::copy_ref_qual_t<Self, base_type>
+  constexpr auto as_tuple(this Self&& self) -> std::tuple<
+      tuple_element_type<Self, blade_type_from_dimensions_t<A, D>>...>
+  {
+    return [&self]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return std::tuple<
+          tuple_element_type<Self, blade_type_from_dimensions_t<A, D>>...>{
+          std::forward<Self>(self).blades_.template get<Is>()...};
+    }(std::make_index_sequence<size>{});
+  }
+
+  /// copy of the coefficients in canonical blade order
+  ///
+  constexpr auto coefficients() const -> std::array<value_type, size>
   {
-    return static_cast<detail::copy_ref_qual_t<Self, base_type>>(
-        std::forward<Self>(self));
+    return [this]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return std::array<value_type, size>{
+          blades_.template get<Is>().coefficient...};
+    }(std::make_index_sequence<size>{});
   }
 
   /// access blade element
@@ -149,7 +212,7 @@ public:
     requires contains<B>
   constexpr auto get(this Self&& self) -> detail::copy_ref_qual_t<Self&&, B>
   {
-    return std::get<B>(std::forward<Self>(self).as_tuple());
+    return std::forward<Self>(self).blades_.template get<index_of<B>>();
   }
 
   template <class B, detail::decays_to<multivector> Self>
@@ -169,9 +232,9 @@ public:
   template <std::size_t I, class Self>
     requires (I < size)
   constexpr auto get(this Self&& self)
-      -> decltype(std::get<I>(std::forward<Self>(self).as_tuple()))
+      -> decltype(std::forward<Self>(self).blades_.template get<I>())
   {
-    return std::get<I>(std::forward<Self>(self).as_tuple());
+    return std::forward<Self>(self).blades_.template get<I>();
   }
 
   template <std::size_t I, detail::decays_to<multivector> Self>
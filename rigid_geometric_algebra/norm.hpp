@@ -0,0 +1,73 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/detail/type_filter.hpp"
+#include "rigid_geometric_algebra/detail/type_list.hpp"
+#include "rigid_geometric_algebra/geometric_fwd.hpp"
+#include "rigid_geometric_algebra/get.hpp"
+#include "rigid_geometric_algebra/is_multivector.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+/// Euclidean norm of the bulk (or weight) of an element
+/// @tparam Weight `false` for the bulk norm, `true` for the weight norm
+///
+template <bool Weight>
+class norm_fn
+{
+  static constexpr auto is_selected = []<class B> {
+    return B::dimension_mask.test(0) == Weight;
+  };
+
+  template <class V>
+  using selected_blade_list_t = detail::type_filter_t<
+      typename std::remove_cvref_t<V>::blade_list_type,
+      is_selected>;
+
+public:
+  template <detail::multivector V>
+  static auto operator()(const V& v) -> algebra_field_t<algebra_type_t<V>>
+  {
+    using T = algebra_field_t<algebra_type_t<V>>;
+    using std::sqrt;
+
+    return [&v]<class... Bs>(detail::type_list<Bs...>) {
+      if constexpr (sizeof...(Bs) == 0) {
+        return T{};
+      } else {
+        return sqrt(
+            ((get<Bs>(v).coefficient * get<Bs>(v).coefficient) + ...));
+      }
+    }(selected_blade_list_t<V>{});
+  }
+
+  template <detail::geometric G>
+  static auto operator()(const G& x) -> decltype(operator()(x.multivector()))
+  {
+    return operator()(x.multivector());
+  }
+};
+
+}  // namespace detail
+
+/// bulk norm
+///
+/// Returns the Euclidean norm of the coefficients of the blades that do not
+/// contain the projective dimension. For a unitized element, the bulk norm is
+/// its distance from the origin.
+///
+inline constexpr auto bulk_norm = detail::norm_fn<false>{};
+
+/// weight norm
+///
+/// Returns the Euclidean norm of the coefficients of the blades that contain
+/// the projective dimension. An element is unitized if its weight norm is one.
+///
+inline constexpr auto weight_norm = detail::norm_fn<true>{};
+
+}  // namespace rigid_geometric_algebra
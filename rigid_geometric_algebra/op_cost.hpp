@@ -0,0 +1,172 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra.hpp"
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/blade.hpp"
+#include "rigid_geometric_algebra/detail/geometric_interface.hpp"
+#include "rigid_geometric_algebra/detail/is_specialization_of.hpp"
+#include "rigid_geometric_algebra/field_identity.hpp"
+#include "rigid_geometric_algebra/is_blade.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/multivector.hpp"
+#include "rigid_geometric_algebra/operation_counts.hpp"
+#include "rigid_geometric_algebra/zero_constant.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+/// field type recording the operations used to compute a value
+///
+/// Each value holds the number of operations in the expression tree that
+/// computed it. Used to evaluate operators during constant evaluation.
+///
+class op_cost_value
+{
+  operation_counts counts_{};
+
+  constexpr explicit op_cost_value(operation_counts counts) noexcept
+      : counts_{counts}
+  {}
+
+  static constexpr auto
+  combine(const op_cost_value& x, const op_cost_value& y, operation_counts op)
+      -> op_cost_value
+  {
+    return op_cost_value{x.counts_ + y.counts_ + op};
+  }
+
+public:
+  op_cost_value() = default;
+
+  /// constructs a value computed without any operations
+  ///
+  template <class T>
+    requires std::is_arithmetic_v<T>
+  constexpr op_cost_value(T) noexcept
+  {}
+
+  [[nodiscard]]
+  constexpr auto counts() const noexcept -> const operation_counts&
+  {
+    return counts_;
+  }
+
+  friend constexpr auto operator-(const op_cost_value& x) -> op_cost_value
+  {
+    return combine(x, {}, {.negations = 1});
+  }
+
+  friend constexpr auto
+  operator+(const op_cost_value& x, const op_cost_value& y) -> op_cost_value
+  {
+    return combine(x, y, {.additions = 1});
+  }
+
+  friend constexpr auto
+  operator-(const op_cost_value& x, const op_cost_value& y) -> op_cost_value
+  {
+    return combine(x, y, {.subtractions = 1});
+  }
+
+  friend constexpr auto
+  operator*(const op_cost_value& x, const op_cost_value& y) -> op_cost_value
+  {
+    return combine(x, y, {.multiplications = 1});
+  }
+
+  friend constexpr auto
+  operator/(const op_cost_value& x, const op_cost_value& y) -> op_cost_value
+  {
+    return combine(x, y, {.divisions = 1});
+  }
+
+  friend auto
+  operator==(const op_cost_value&, const op_cost_value&) -> bool = default;
+};
+
+// multivector or blade type `T` with field `op_cost_value`
+template <class T>
+struct op_cost_rebind
+{
+  using type = typename op_cost_rebind<typename T::multivector_type>::type;
+};
+
+template <class A, auto... D>
+struct op_cost_rebind<::rigid_geometric_algebra::multivector<A, D...>>
+{
+  using type = ::rigid_geometric_algebra::
+      multivector<algebra<op_cost_value, algebra_dimension_v<A> - 1>, D...>;
+};
+
+template <class A, std::size_t... Is>
+struct op_cost_rebind<::rigid_geometric_algebra::blade<A, Is...>>
+{
+  using type = ::rigid_geometric_algebra::
+      blade<algebra<op_cost_value, algebra_dimension_v<A> - 1>, Is...>;
+};
+
+template <const auto& Op, class... Ts>
+consteval auto op_cost_impl() -> operation_counts
+{
+  const auto r = Op(typename op_cost_rebind<Ts>::type{}...);
+  using R = std::remove_cvref_t<decltype(r)>;
+
+  if constexpr (is_specialization_of_v<R, zero_constant>) {
+    return {};
+  } else if constexpr (is_blade_v<R>) {
+    return r.coefficient.counts();
+  } else {
+    return [&r]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return (operation_counts{} + ... +
+              r.template get<Is>().coefficient.counts());
+    }(std::make_index_sequence<R::size>{});
+  }
+}
+
+}  // namespace detail
+
+/// field identity value for operation cost multiplication
+///
+template <>
+inline constexpr auto
+    field_identity<detail::op_cost_value, std::multiplies<>> =
+        detail::op_cost_value{1};
+
+/// disable line invariant checks for operation costs
+///
+template <>
+inline constexpr auto disable_line_invariant<detail::op_cost_value> = true;
+
+/// number of arithmetic operations performed by an operator
+/// @tparam Op operator function object with static storage duration, e.g.
+///   `wedge`
+/// @tparam Ts argument types, each a geometric type, `multivector`, or
+///   `blade`
+///
+/// Determines the number of additions, subtractions, multiplications,
+/// divisions, and negations performed by `Op(xs...)` for arguments of types
+/// `Ts...`, e.g.
+/// ```
+/// static_assert(op_cost<wedge, point<A>, point<A>>.multiplications == 12);
+/// static_assert(op_cost<antiwedge, line<A>, plane<A>>.total() <= 30);
+/// ```
+///
+/// The operator is evaluated during constant evaluation with arguments whose
+/// coefficients record the operations applied to them. Only blade pairs kept
+/// by the `type_product`/`type_filter` pruning of the operator's multivector
+/// overloads contribute, so for linear and bilinear operators such as
+/// `wedge`, `antiwedge`, and the complements the result equals the number of
+/// operations performed at run time. For operators that reuse an intermediate
+/// value, the operations computing it are counted for each use.
+///
+/// The field type of the argument algebras is ignored.
+///
+template <const auto& Op, class... Ts>
+inline constexpr auto op_cost = detail::op_cost_impl<Op, Ts...>();
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+
+namespace rigid_geometric_algebra {
+
+/// number of arithmetic operations of each kind
+///
+struct operation_counts
+{
+  std::size_t additions{};
+  std::size_t subtractions{};
+  std::size_t multiplications{};
+  std::size_t divisions{};
+  std::size_t negations{};
+
+  /// total number of operations
+  ///
+  [[nodiscard]]
+  constexpr auto total() const noexcept -> std::size_t
+  {
+    return additions + subtractions + multiplications + divisions + negations;
+  }
+
+  /// sum of operation counts
+  ///
+  friend constexpr auto
+  operator+(const operation_counts& x, const operation_counts& y) noexcept
+      -> operation_counts
+  {
+    return {
+        x.additions + y.additions,
+        x.subtractions + y.subtractions,
+        x.multiplications + y.multiplications,
+        x.divisions + y.divisions,
+        x.negations + y.negations};
+  }
+
+  friend auto operator==(const operation_counts&, const operation_counts&)
+      -> bool = default;
+};
+
+}  // namespace rigid_geometric_algebra
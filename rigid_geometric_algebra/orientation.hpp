@@ -0,0 +1,203 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra.hpp"
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/antiwedge.hpp"
+#include "rigid_geometric_algebra/common_algebra_type.hpp"
+#include "rigid_geometric_algebra/detail/error_bound.hpp"
+#include "rigid_geometric_algebra/geometric_fwd.hpp"
+#include "rigid_geometric_algebra/interval.hpp"
+#include "rigid_geometric_algebra/multivector.hpp"
+#include "rigid_geometric_algebra/point.hpp"
+#include "rigid_geometric_algebra/wedge.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace rigid_geometric_algebra {
+
+/// evaluation stage that determined an orientation
+///
+enum class orientation_stage
+{
+  /// floating-point evaluation with an a priori error bound
+  filter,
+  /// interval evaluation
+  interval,
+};
+
+namespace detail {
+
+class orientation_fn
+{
+  // copy of `v` with the coefficients converted to field `U`
+  template <class U, class A, auto... D, class F>
+  static constexpr auto
+  rebind(const ::rigid_geometric_algebra::multivector<A, D...>& v, F f)
+      -> ::rigid_geometric_algebra::
+          multivector<algebra<U, algebra_dimension_v<A> - 1>, D...>
+  {
+    using R = ::rigid_geometric_algebra::
+        multivector<algebra<U, algebra_dimension_v<A> - 1>, D...>;
+
+    return [&v, &f]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return R{
+          U{f(v.template get<Is>().coefficient)}...};
+    }(std::make_index_sequence<sizeof...(D)>{});
+  }
+
+  template <class V1, class V2>
+  static constexpr auto value(const V1& x, const V2& y)
+  {
+    return antiwedge(x, y);
+  }
+
+  template <class V>
+  static constexpr auto
+  value(const V& p0, const V& p1, const V& p2, const V& p3)
+  {
+    return antiwedge(wedge(wedge(p0, p1), p2), p3);
+  }
+
+  template <class U, class F, class... Ts>
+  static constexpr auto evaluate(F f, const Ts&... xs) -> U
+  {
+    const auto r = value(rebind<U>(xs.multivector(), f)...);
+
+    static_assert(
+        std::remove_cvref_t<decltype(r)>::size == 1 and
+            std::remove_cvref_t<decltype(r)>::template contains<
+                typename algebra_type_t<decltype(r)>::scalar>,
+        "orientation is only defined for elements with a scalar "
+        "antiwedge product");
+
+    return r.template get<0>().coefficient;
+  }
+
+  // checks that no product of `sizeof...(Ts)` coefficients overflows or
+  // underflows
+  template <class T, class... Ts>
+  static constexpr auto in_filter_range(const Ts&... xs) -> bool
+  {
+    using limits = std::numeric_limits<T>;
+
+    // allow for sums of up to 2^16 products
+    constexpr auto exponent =
+        (std::min(limits::max_exponent, -limits::min_exponent) - 16) /
+        int{sizeof...(Ts)};
+    static constexpr auto upper = [] {
+      auto x = T{1};
+      for (auto i = 0; i != exponent; ++i) {
+        x *= T{2};
+      }
+      return x;
+    }();
+    static constexpr auto lower = T{1} / upper;
+
+    const auto in_range = [](const auto& x) {
+      return std::ranges::all_of(x, [](T c) {
+        const auto a = std::abs(c);
+        return a == T{} or (lower <= a and a <= upper);
+      });
+    };
+
+    return (in_range(xs) and ...);
+  }
+
+  template <class... Ts>
+  static constexpr auto is_orientable_v = [] {
+    if constexpr (
+        (sizeof...(Ts) == 2 or sizeof...(Ts) == 4) and
+        (detail::geometric<Ts> and ...) and
+        has_common_algebra_type_v<Ts...>) {
+      return std::floating_point<
+          algebra_field_t<common_algebra_type_t<Ts...>>>;
+    } else {
+      return false;
+    }
+  }();
+
+public:
+  template <class... Ts>
+    requires is_orientable_v<Ts...>
+  static constexpr auto operator()(orientation_stage& stage, const Ts&... xs)
+      -> std::partial_ordering
+  {
+    using T = algebra_field_t<common_algebra_type_t<Ts...>>;
+
+    if (in_filter_range<T>(xs...)) {
+      const auto value = evaluate<T>(std::identity{}, xs...);
+      const auto error =
+          evaluate<detail::error_bound<T>>(std::identity{}, xs...);
+
+      if (std::abs(value) > error.bound()) {
+        stage = orientation_stage::filter;
+        return value <=> T{};
+      }
+    }
+
+    stage = orientation_stage::interval;
+
+    const auto value = evaluate<interval<T>>(std::identity{}, xs...);
+
+    if (T{} < value.lower()) {
+      return std::partial_ordering::greater;
+    }
+    if (value.upper() < T{}) {
+      return std::partial_ordering::less;
+    }
+    if (value.lower() == value.upper()) {
+      return std::partial_ordering::equivalent;
+    }
+    return std::partial_ordering::unordered;
+  }
+
+  template <class... Ts>
+    requires is_orientable_v<Ts...>
+  static constexpr auto
+  operator()(const Ts&... xs) -> std::partial_ordering
+  {
+    auto stage = orientation_stage{};
+    return orientation_fn{}(stage, xs...);
+  }
+};
+
+}  // namespace detail
+
+/// robust orientation predicate
+///
+/// Determines the sign of the antiwedge product of two elements whose
+/// antiwedge product is a scalar, such as
+/// * `orientation(g, p)`, a plane and a point, which is positive if `p` lies
+///   on the side of `g` its normal points toward
+/// * `orientation(l1, l2)`, two lines, which is zero if they intersect and
+///   otherwise gives the handedness with which they pass each other
+///
+/// The sign of `antiwedge(wedge(wedge(p0, p1), p2), p3)`, positive if `p3`
+/// lies on the side of the plane through `p0`, `p1`, and `p2` toward which
+/// the points turn counterclockwise, is determined with
+/// `orientation(p0, p1, p2, p3)`.
+///
+/// The sign is first evaluated in the field type of the elements, and is
+/// returned if it exceeds an a priori bound on the rounding error. Otherwise,
+/// the sign is evaluated using `interval` arithmetic. Returns
+/// * `greater` or `less` if the sign is certain
+/// * `equivalent` if the value is exactly zero
+/// * `unordered` if the sign cannot be determined, which may only occur if
+///   the value is zero or near zero relative to the rounding error
+///
+/// `orientation(stage, xs...)` additionally stores the stage that determined
+/// the result in the `orientation_stage` `stage`.
+///
+/// @note Requires: the field type is a floating-point type
+///
+inline constexpr auto orientation = detail::orientation_fn{};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,242 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/plane.hpp"
+#include "rigid_geometric_algebra/point.hpp"
+#include "rigid_geometric_algebra/soa_span.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace rigid_geometric_algebra {
+
+/// position of a region relative to the intersection of the negative
+/// half-spaces of a set of planes
+///
+enum class containment
+{
+  /// the region is strictly on the negative side of every plane
+  inside,
+  /// the region is strictly on the positive side of some plane
+  outside,
+  /// the region is neither inside nor outside
+  straddling,
+};
+
+/// set of planes stored for batched classification
+/// @tparam A algebra type
+/// @tparam K number of planes
+///
+/// Stores the coefficients of `K` planes transposed, with one array of `K`
+/// values for each blade. Classifying an element evaluates the antiwedge of
+/// every plane with the element from contiguous arrays, allowing the planes
+/// to be tested together with SIMD instructions.
+///
+/// Each plane bounds the set with its normal pointing outward, as for the
+/// faces of a frustum or a portal. A region is inside the set if it is on the
+/// negative side of each plane.
+///
+template <class A, std::size_t K>
+  requires (algebra_dimension_v<A> == 4) and (K != 0)
+class plane_set
+{
+  using value_type = algebra_field_t<A>;
+
+  // coefficients_[j][k] is the coefficient of blade `j` of plane `k`
+  std::array<std::array<value_type, K>, 4> coefficients_{};
+
+  // absolute values of the normal coefficients
+  std::array<std::array<value_type, K>, 3> magnitudes_{};
+
+  template <class P>
+  static constexpr auto is_point_v =
+      std::same_as<std::remove_const_t<P>, point<A>>;
+
+  // classifies a box with center `(w, x, y, z)` and half extents
+  // `(ex, ey, ez)` from the largest signed distances of its near and far
+  // corners from each plane, scaled by the weight `w`
+  //
+  // `a x + b y + c z + d w` is the scalar coefficient of the antiwedge of a
+  // plane `(a, b, c, d)` and the center.
+  constexpr auto classify_box(
+      value_type w,
+      value_type x,
+      value_type y,
+      value_type z,
+      value_type ex,
+      value_type ey,
+      value_type ez) const -> containment
+  {
+    const auto& [a, b, c, d] = coefficients_;
+    const auto& [ma, mb, mc] = magnitudes_;
+
+    auto near = a[0] * x + b[0] * y + c[0] * z + d[0] * w;
+    auto far = near;
+    {
+      const auto r = w * (ma[0] * ex + mb[0] * ey + mc[0] * ez);
+      near -= r;
+      far += r;
+    }
+
+    for (auto k = 1UZ; k != K; ++k) {
+      const auto s = a[k] * x + b[k] * y + c[k] * z + d[k] * w;
+      const auto r = w * (ma[k] * ex + mb[k] * ey + mc[k] * ez);
+      near = std::max(near, s - r);
+      far = std::max(far, s + r);
+    }
+
+    return near > value_type{}  ? containment::outside
+           : far < value_type{} ? containment::inside
+                                : containment::straddling;
+  }
+
+public:
+  /// constructs a set of planes
+  /// @param planes planes bounding the set, with normals pointing outward
+  ///
+  constexpr explicit plane_set(const std::array<plane<A>, K>& planes)
+  {
+    using std::abs;
+
+    for (auto k = 0UZ; k != K; ++k) {
+      for (auto j = 0UZ; j != 4; ++j) {
+        coefficients_[j][k] = planes[k][j];
+      }
+      for (auto j = 0UZ; j != 3; ++j) {
+        magnitudes_[j][k] = abs(planes[k][j]);
+      }
+    }
+  }
+
+  /// number of planes
+  ///
+  static constexpr auto size() noexcept -> std::size_t { return K; }
+
+  /// loads a plane
+  /// @param k plane index
+  ///
+  /// @pre `k < size()`
+  ///
+  constexpr auto operator[](std::size_t k) const -> plane<A>
+  {
+    detail::precondition(k < K, [k] {
+      return detail::contract_violation_handler{
+          "plane index '{}' must be less than '{}'", k, K};
+    });
+
+    return plane<A>{
+        coefficients_[0][k],
+        coefficients_[1][k],
+        coefficients_[2][k],
+        coefficients_[3][k]};
+  }
+
+  /// classifies a point
+  /// @param p point with positive weight
+  ///
+  /// Returns `inside` or `outside` if the antiwedge of `p` with every plane
+  /// is negative or with some plane is positive, and `straddling` if `p` is
+  /// on the boundary of the set.
+  ///
+  constexpr auto classify(const point<A>& p) const -> containment
+  {
+    return classify_box(p[0], p[1], p[2], p[3], {}, {}, {});
+  }
+
+  /// classifies an axis-aligned bounding box
+  /// @param center box center with positive weight
+  /// @param extent half extents of the box as a direction, with zero weight
+  ///
+  /// The box is `outside` if it is on the positive side of some plane,
+  /// `inside` if it is on the negative side of every plane, and
+  /// `straddling` otherwise. For each plane, the signed distance of the box
+  /// is the antiwedge of the plane with `center`, offset by the antiwedge of
+  /// the plane with absolute normal coefficients and `extent`.
+  ///
+  /// A box that is on the positive side of none of the planes, but is outside
+  /// of their intersection, is classified as `straddling`.
+  ///
+  constexpr auto classify(const point<A>& center, const point<A>& extent) const
+      -> containment
+  {
+    return classify_box(
+        center[0],
+        center[1],
+        center[2],
+        center[3],
+        extent[1],
+        extent[2],
+        extent[3]);
+  }
+
+  /// classifies a batch of points
+  /// @param points points with positive weight
+  /// @param out classification of each point
+  ///
+  /// @pre `points.size() == out.size()`
+  ///
+  template <class P>
+    requires is_point_v<P>
+  constexpr auto classify(soa_span<P> points, std::span<containment> out) const
+      -> void
+  {
+    detail::precondition(points.size() == out.size(), [n = out.size()] {
+      return detail::contract_violation_handler{
+          "number of points must be '{}'", n};
+    });
+
+    const auto w = points.column(0);
+    const auto x = points.column(1);
+    const auto y = points.column(2);
+    const auto z = points.column(3);
+
+    for (auto i = 0UZ; i != out.size(); ++i) {
+      out[i] = classify_box(w[i], x[i], y[i], z[i], {}, {}, {});
+    }
+  }
+
+  /// classifies a batch of axis-aligned bounding boxes
+  /// @param centers box centers with positive weight
+  /// @param extents half extents of each box as a direction, with zero
+  ///   weight
+  /// @param out classification of each box
+  ///
+  /// @pre `centers.size() == out.size()`
+  /// @pre `extents.size() == out.size()`
+  ///
+  template <class P, class E>
+    requires is_point_v<P> and is_point_v<E>
+  constexpr auto classify(
+      soa_span<P> centers,
+      soa_span<E> extents,
+      std::span<containment> out) const -> void
+  {
+    detail::precondition(
+        centers.size() == out.size() and extents.size() == out.size(),
+        [n = out.size()] {
+          return detail::contract_violation_handler{
+              "number of centers and extents must be '{}'", n};
+        });
+
+    const auto w = centers.column(0);
+    const auto x = centers.column(1);
+    const auto y = centers.column(2);
+    const auto z = centers.column(3);
+    const auto ex = extents.column(1);
+    const auto ey = extents.column(2);
+    const auto ez = extents.column(3);
+
+    for (auto i = 0UZ; i != out.size(); ++i) {
+      out[i] = classify_box(w[i], x[i], y[i], z[i], ex[i], ey[i], ez[i]);
+    }
+  }
+};
+
+}  // namespace rigid_geometric_algebra
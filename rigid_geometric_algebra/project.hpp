@@ -0,0 +1,52 @@
+#pragma once
+
+#include "rigid_geometric_algebra/antiwedge.hpp"
+#include "rigid_geometric_algebra/detail/derive_soa_overload.hpp"
+#include "rigid_geometric_algebra/detail/geometric_operator.hpp"
+#include "rigid_geometric_algebra/expand.hpp"
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class project_value_fn : public detail::geometric_operator
+{
+public:
+  using detail::geometric_operator::operator();
+
+  template <class T1, class T2>
+  static constexpr auto operator()(const T1& a, const T2& b)
+      -> decltype(antiwedge(b, expand(a, b)))
+  {
+    return antiwedge(b, expand(a, b));
+  }
+};
+
+class project_fn : public project_value_fn,
+                   public derive_soa_overload<project_value_fn>
+{
+public:
+  using project_value_fn::operator();
+  using derive_soa_overload<project_value_fn>::operator();
+};
+
+}  // namespace detail
+
+/// orthogonal projection
+/// @param a element to project
+/// @param b element projected onto
+///
+/// Returns `antiwedge(b, expand(a, b))`, the orthogonal projection of `a`
+/// onto `b`. Supported geometric type pairs are
+/// * `point` onto `line` or `plane`, returning a `point`
+/// * `line` onto `plane`, returning a `line`
+///
+/// The weight of the result is the squared weight norm of `b` times the weight
+/// of `a`. Only blades that may be nonzero are computed.
+///
+/// Batches may be projected with `project(as, bs, out)` or, onto a single
+/// element, with `project(as, b, out)`, where `as`, `bs`, and `out` are
+/// `soa_span`s.
+///
+inline constexpr auto project = detail::project_fn{};
+
+}  // namespace rigid_geometric_algebra
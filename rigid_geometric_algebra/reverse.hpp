@@ -0,0 +1,65 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/detail/geometric_operator.hpp"
+#include "rigid_geometric_algebra/detail/linear_operator.hpp"
+#include "rigid_geometric_algebra/detail/negate_if_odd.hpp"
+#include "rigid_geometric_algebra/is_blade.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+/// reverses the order of factors (or antifactors) of a blade
+/// @tparam Anti `false` for the reverse, `true` for the antireverse
+///
+template <bool Anti>
+class reverse_blade_fn
+{
+public:
+  template <detail::blade B>
+  static constexpr auto operator()(B&& b) -> std::remove_cvref_t<B>
+  {
+    static constexpr auto k =
+        Anti ? algebra_dimension_v<algebra_type_t<B>> -
+                   std::remove_cvref_t<B>::grade
+             : std::remove_cvref_t<B>::grade;
+
+    static constexpr auto sign = k * (k - 1) / 2;
+
+    return std::remove_cvref_t<B>{
+        detail::negate_if_odd<sign>{}(std::forward<B>(b).coefficient)};
+  }
+};
+
+template <bool Anti>
+class reverse_fn
+    : public detail::linear_operator<detail::reverse_blade_fn<Anti>>,
+      public detail::geometric_operator
+{
+public:
+  using detail::linear_operator<detail::reverse_blade_fn<Anti>>::operator();
+  using detail::geometric_operator::operator();
+};
+
+}  // namespace detail
+
+/// reverse of a blade
+///
+/// Reverses the order of the factors of a blade. A blade of grade `k` is
+/// negated if `k * (k - 1) / 2` is odd.
+///
+inline constexpr auto reverse = detail::reverse_fn<false>{};
+
+/// antireverse of a blade
+///
+/// Reverses the order of the antifactors of a blade. A blade of antigrade `k`
+/// is negated if `k * (k - 1) / 2` is odd.
+///
+inline constexpr auto antireverse = detail::reverse_fn<true>{};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/get.hpp"
+#include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/motor.hpp"
+
+#include <array>
+
+namespace rigid_geometric_algebra {
+
+/// state of a rigid body
+/// @tparam A algebra type
+///
+/// The pose is the motor that transforms elements from body coordinates to
+/// world coordinates. The velocity is the bivector `B`, in body coordinates,
+/// such that the pose changes as:
+/// ```
+/// d/dt pose = 1/2 geometric_antiproduct(pose, B)
+/// ```
+/// If a body rotates with angular velocity `ω` and its origin moves with
+/// linear velocity `u`, both in body coordinates, the direction of `B` is
+/// `-ω` and the moment of `B` is `-u`. In general, `B` is not a line.
+///
+template <class A>
+  requires is_algebra_v<A> and (algebra_dimension_v<A> == 4)
+struct rigid_body
+{
+  /// algebra type
+  ///
+  using algebra_type = A;
+
+  /// blade scalar type
+  ///
+  using value_type = algebra_field_t<A>;
+
+  /// bivector type
+  ///
+  using bivector_type = typename line<A>::multivector_type;
+
+  motor<A> pose{motor<A>::identity()};
+  bivector_type velocity{};
+
+  /// equality comparison
+  ///
+  friend auto
+  operator==(const rigid_body&, const rigid_body&) -> bool = default;
+};
+
+/// mass properties of a rigid body
+/// @tparam A algebra type
+///
+/// Describes a body with its origin at the center of mass and its axes
+/// aligned with the principal axes of inertia.
+///
+/// The inertia maps a velocity bivector to a momentum bivector. The direction
+/// of a momentum is the linear momentum and the moment of a momentum is the
+/// angular momentum about the body origin. A force `f` acting along a line
+/// through point `c` is described by the forque with direction `f` and moment
+/// `c × f`, which has the same layout as a momentum.
+///
+template <class A>
+  requires is_algebra_v<A> and (algebra_dimension_v<A> == 4)
+struct rigid_body_inertia
+{
+  /// algebra type
+  ///
+  using algebra_type = A;
+
+  /// blade scalar type
+  ///
+  using value_type = algebra_field_t<A>;
+
+  /// bivector type
+  ///
+  using bivector_type = typename line<A>::multivector_type;
+
+private:
+  static constexpr auto coefficients(const bivector_type& b)
+  {
+    return std::array{
+        get<typename A::template blade<0, 1>>(b).coefficient,
+        get<typename A::template blade<0, 2>>(b).coefficient,
+        get<typename A::template blade<0, 3>>(b).coefficient,
+        get<typename A::template blade<2, 3>>(b).coefficient,
+        get<typename A::template blade<3, 1>>(b).coefficient,
+        get<typename A::template blade<1, 2>>(b).coefficient};
+  }
+
+public:
+  value_type mass{1};
+  value_type moment_x{1};
+  value_type moment_y{1};
+  value_type moment_z{1};
+
+  /// obtains the momentum of a velocity
+  /// @param velocity velocity bivector in body coordinates
+  ///
+  [[nodiscard]]
+  constexpr auto momentum(const bivector_type& velocity) const -> bivector_type
+  {
+    const auto [vx, vy, vz, mx, my, mz] = coefficients(velocity);
+
+    return bivector_type{
+        -mass * mx,
+        -mass * my,
+        -mass * mz,
+        -moment_x * vx,
+        -moment_y * vy,
+        -moment_z * vz};
+  }
+
+  /// obtains the velocity of a momentum
+  /// @param momentum momentum bivector in body coordinates
+  ///
+  /// @pre `mass`, `moment_x`, `moment_y`, and `moment_z` are nonzero
+  ///
+  [[nodiscard]]
+  constexpr auto velocity(const bivector_type& momentum) const -> bivector_type
+  {
+    const auto [px, py, pz, lx, ly, lz] = coefficients(momentum);
+
+    return bivector_type{
+        -lx / moment_x,
+        -ly / moment_y,
+        -lz / moment_z,
+        -px / mass,
+        -py / mass,
+        -pz / mass};
+  }
+
+  /// equality comparison
+  ///
+  friend auto operator==(const rigid_body_inertia&, const rigid_body_inertia&)
+      -> bool = default;
+};
+
+}  // namespace rigid_geometric_algebra
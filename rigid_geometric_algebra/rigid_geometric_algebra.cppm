@@ -0,0 +1,135 @@
+module;
+
+// IWYU pragma: begin_keep
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+// IWYU pragma: end_keep
+
+/// module interface unit for `rigid_geometric_algebra`
+///
+/// Exports the public names of `rigid_geometric_algebra.hpp`. Declarations
+/// are attached to the global module, so entities are shared with
+/// translation units that include the headers directly. Names in
+/// `rigid_geometric_algebra::detail` are not exported but remain reachable
+/// through exported declarations.
+///
+/// ```
+/// import rigid_geometric_algebra;
+///
+/// using G3 = rigid_geometric_algebra::algebra<double, 3>;
+/// ```
+///
+export module rigid_geometric_algebra;
+
+export namespace rigid_geometric_algebra {
+
+using ::rigid_geometric_algebra::algebra;
+using ::rigid_geometric_algebra::algebra_dimension;
+using ::rigid_geometric_algebra::algebra_dimension_v;
+using ::rigid_geometric_algebra::algebra_field;
+using ::rigid_geometric_algebra::algebra_field_t;
+using ::rigid_geometric_algebra::algebra_type;
+using ::rigid_geometric_algebra::algebra_type_t;
+using ::rigid_geometric_algebra::angle;
+using ::rigid_geometric_algebra::antiproject;
+using ::rigid_geometric_algebra::antireverse;
+using ::rigid_geometric_algebra::antiscalar_type;
+using ::rigid_geometric_algebra::antiscalar_type_t;
+using ::rigid_geometric_algebra::antiwedge;
+using ::rigid_geometric_algebra::axpy;
+using ::rigid_geometric_algebra::blade;
+using ::rigid_geometric_algebra::blade_complement_type;
+using ::rigid_geometric_algebra::blade_complement_type_t;
+using ::rigid_geometric_algebra::blade_dimensions;
+using ::rigid_geometric_algebra::blade_ordering;
+using ::rigid_geometric_algebra::blade_sum;
+using ::rigid_geometric_algebra::blade_type_from_dimensions;
+using ::rigid_geometric_algebra::blade_type_from_dimensions_t;
+using ::rigid_geometric_algebra::blade_type_from_mask;
+using ::rigid_geometric_algebra::blade_type_from_mask_t;
+using ::rigid_geometric_algebra::bulk_dual;
+using ::rigid_geometric_algebra::bulk_norm;
+using ::rigid_geometric_algebra::canonical_dimension_order;
+using ::rigid_geometric_algebra::canonical_type;
+using ::rigid_geometric_algebra::canonical_type_t;
+using ::rigid_geometric_algebra::closest_points;
+using ::rigid_geometric_algebra::common_algebra_type;
+using ::rigid_geometric_algebra::common_algebra_type_t;
+using ::rigid_geometric_algebra::complement;
+using ::rigid_geometric_algebra::containment;
+using ::rigid_geometric_algebra::convex_hull;
+using ::rigid_geometric_algebra::convex_hull_workspace;
+using ::rigid_geometric_algebra::counted;
+using ::rigid_geometric_algebra::disable_line_invariant;
+using ::rigid_geometric_algebra::distance;
+using ::rigid_geometric_algebra::dual_number;
+using ::rigid_geometric_algebra::dynamic_multivector;
+using ::rigid_geometric_algebra::exp;
+using ::rigid_geometric_algebra::expand;
+using ::rigid_geometric_algebra::field;
+using ::rigid_geometric_algebra::field_identity;
+using ::rigid_geometric_algebra::fixed_point;
+using ::rigid_geometric_algebra::geometric_antiproduct;
+using ::rigid_geometric_algebra::geometric_product;
+using ::rigid_geometric_algebra::get;
+using ::rigid_geometric_algebra::get_or;
+using ::rigid_geometric_algebra::halfspace_intersection;
+using ::rigid_geometric_algebra::has_common_algebra_type;
+using ::rigid_geometric_algebra::has_common_algebra_type_v;
+using ::rigid_geometric_algebra::homogeneous_magnitude;
+using ::rigid_geometric_algebra::homogeneous_magnitude_t;
+using ::rigid_geometric_algebra::integrate;
+using ::rigid_geometric_algebra::interpolate;
+using ::rigid_geometric_algebra::interval;
+using ::rigid_geometric_algebra::is_algebra;
+using ::rigid_geometric_algebra::is_algebra_v;
+using ::rigid_geometric_algebra::is_blade;
+using ::rigid_geometric_algebra::is_blade_v;
+using ::rigid_geometric_algebra::is_canonical_blade_order;
+using ::rigid_geometric_algebra::is_multivector;
+using ::rigid_geometric_algebra::is_multivector_v;
+using ::rigid_geometric_algebra::join_triangles;
+using ::rigid_geometric_algebra::left;
+using ::rigid_geometric_algebra::left_complement;
+using ::rigid_geometric_algebra::left_t;
+using ::rigid_geometric_algebra::line;
+using ::rigid_geometric_algebra::log;
+using ::rigid_geometric_algebra::magma;
+using ::rigid_geometric_algebra::motor;
+using ::rigid_geometric_algebra::multivector;
+using ::rigid_geometric_algebra::multivector_type_from_blade_list;
+using ::rigid_geometric_algebra::multivector_type_from_blade_list_t;
+using ::rigid_geometric_algebra::one;
+using ::rigid_geometric_algebra::op_cost;
+using ::rigid_geometric_algebra::operation_counts;
+using ::rigid_geometric_algebra::orientation;
+using ::rigid_geometric_algebra::orientation_stage;
+using ::rigid_geometric_algebra::overflow_policy;
+using ::rigid_geometric_algebra::plane;
+using ::rigid_geometric_algebra::plane_set;
+using ::rigid_geometric_algebra::point;
+using ::rigid_geometric_algebra::project;
+using ::rigid_geometric_algebra::reverse;
+using ::rigid_geometric_algebra::right;
+using ::rigid_geometric_algebra::right_complement;
+using ::rigid_geometric_algebra::right_t;
+using ::rigid_geometric_algebra::rigid_body;
+using ::rigid_geometric_algebra::rigid_body_inertia;
+using ::rigid_geometric_algebra::scalar_type;
+using ::rigid_geometric_algebra::scalar_type_t;
+using ::rigid_geometric_algebra::skin;
+using ::rigid_geometric_algebra::soa_span;
+using ::rigid_geometric_algebra::sorted_canonical_blades;
+using ::rigid_geometric_algebra::sorted_canonical_blades_t;
+using ::rigid_geometric_algebra::sparse_multivector;
+using ::rigid_geometric_algebra::to_multivector;
+using ::rigid_geometric_algebra::to_multivector_t;
+using ::rigid_geometric_algebra::transform;
+using ::rigid_geometric_algebra::unit_hypervolume;
+using ::rigid_geometric_algebra::unspecified;
+using ::rigid_geometric_algebra::wedge;
+using ::rigid_geometric_algebra::weight_contraction;
+using ::rigid_geometric_algebra::weight_dual;
+using ::rigid_geometric_algebra::weight_norm;
+using ::rigid_geometric_algebra::zero_constant;
+
+}  // namespace rigid_geometric_algebra
@@ -15,7 +15,10 @@ namespace rigid_geometric_algebra {}  // namespace rigid_geometric_algebra
 #include "rigid_geometric_algebra/algebra_field.hpp"
 #include "rigid_geometric_algebra/algebra_fwd.hpp"
 #include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/angle.hpp"
+#include "rigid_geometric_algebra/antiproject.hpp"
 #include "rigid_geometric_algebra/antiwedge.hpp"
+#include "rigid_geometric_algebra/axpy.hpp"
 #include "rigid_geometric_algebra/blade.hpp"
 #include "rigid_geometric_algebra/blade_complement_type.hpp"
 #include "rigid_geometric_algebra/blade_dimensions.hpp"
@@ -23,24 +26,56 @@ namespace rigid_geometric_algebra {}  // namespace rigid_geometric_algebra
 #include "rigid_geometric_algebra/blade_type_from.hpp"
 #include "rigid_geometric_algebra/canonical_dimension_order.hpp"
 #include "rigid_geometric_algebra/canonical_type.hpp"
+#include "rigid_geometric_algebra/closest_points.hpp"
 #include "rigid_geometric_algebra/complement.hpp"
+#include "rigid_geometric_algebra/convex_hull.hpp"
+#include "rigid_geometric_algebra/counted.hpp"
+#include "rigid_geometric_algebra/distance.hpp"
+#include "rigid_geometric_algebra/dual.hpp"
+#include "rigid_geometric_algebra/dual_number.hpp"
+#include "rigid_geometric_algebra/dynamic_multivector.hpp"
+#include "rigid_geometric_algebra/exp.hpp"
+#include "rigid_geometric_algebra/expand.hpp"
 #include "rigid_geometric_algebra/field.hpp"
 #include "rigid_geometric_algebra/field_identity.hpp"
+#include "rigid_geometric_algebra/fixed_point.hpp"
+#include "rigid_geometric_algebra/geometric_antiproduct.hpp"
+#include "rigid_geometric_algebra/geometric_product.hpp"
 #include "rigid_geometric_algebra/get.hpp"
 #include "rigid_geometric_algebra/get_or.hpp"
+#include "rigid_geometric_algebra/homogeneous_magnitude.hpp"
+#include "rigid_geometric_algebra/integrate.hpp"
+#include "rigid_geometric_algebra/interpolate.hpp"
+#include "rigid_geometric_algebra/interval.hpp"
 #include "rigid_geometric_algebra/is_algebra.hpp"
 #include "rigid_geometric_algebra/is_blade.hpp"
 #include "rigid_geometric_algebra/is_canonical_blade_order.hpp"
 #include "rigid_geometric_algebra/is_multivector.hpp"
+#include "rigid_geometric_algebra/join_triangles.hpp"
 #include "rigid_geometric_algebra/line.hpp"
+#include "rigid_geometric_algebra/log.hpp"
 #include "rigid_geometric_algebra/magma.hpp"
+#include "rigid_geometric_algebra/motor.hpp"
 #include "rigid_geometric_algebra/multivector.hpp"
+#include "rigid_geometric_algebra/norm.hpp"
 #include "rigid_geometric_algebra/one.hpp"
+#include "rigid_geometric_algebra/op_cost.hpp"
+#include "rigid_geometric_algebra/operation_counts.hpp"
+#include "rigid_geometric_algebra/orientation.hpp"
 #include "rigid_geometric_algebra/plane.hpp"
+#include "rigid_geometric_algebra/plane_set.hpp"
 #include "rigid_geometric_algebra/point.hpp"
+#include "rigid_geometric_algebra/project.hpp"
+#include "rigid_geometric_algebra/reverse.hpp"
+#include "rigid_geometric_algebra/rigid_body.hpp"
 #include "rigid_geometric_algebra/scalar_type.hpp"
+#include "rigid_geometric_algebra/skin.hpp"
+#include "rigid_geometric_algebra/soa_span.hpp"
+#include "rigid_geometric_algebra/sparse_multivector.hpp"
 #include "rigid_geometric_algebra/to_multivector.hpp"
+#include "rigid_geometric_algebra/transform.hpp"
 #include "rigid_geometric_algebra/unit_hypervolume.hpp"
 #include "rigid_geometric_algebra/wedge.hpp"
+#include "rigid_geometric_algebra/weight_contraction.hpp"
 #include "rigid_geometric_algebra/zero_constant.hpp"
 // IWYU pragma: end_exports
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/detail/for_each_partition.hpp"
+#include "rigid_geometric_algebra/motor.hpp"
+#include "rigid_geometric_algebra/point.hpp"
+#include "rigid_geometric_algebra/soa_span.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class skin_fn
+{
+  // coefficients of a motor, in canonical blade order
+  //
+  // `q[0]` is the scalar, `q[1..3]` the blades `e01`, `e02`, `e03`,
+  // `q[4..6]` the blades `e23`, `e31`, `e12`, and `q[7]` the antiscalar
+  template <class T>
+  using motor_coefficients = std::array<T, 8>;
+
+  // Euclidean coefficients of
+  // `geometric_antiproduct(geometric_antiproduct(q, p), antireverse(q))`
+  // for a point `p` with weight `w`, divided by the squared weight norm of
+  // `q`
+  //
+  // Only the blades of a point are expanded. With `v = (q[1], q[2], q[3])`,
+  // `m = (q[4], q[5], q[6])`, `s = q[0]`, and `a = q[7]`, the sandwich
+  // rotates `(x, y, z)` by the matrix formed from `a` and `v` and translates
+  // it by `-2 w (a m + m x v + s v)`, and the weight is scaled by
+  // `a^2 + v.v`. Dividing by `a^2 + v.v` gives the transform by the
+  // normalized motor without a square root. The bulk component of `q` that
+  // is not orthogonal to its weight does not contribute to the result.
+  template <class T>
+  static constexpr auto sandwich(
+      const motor_coefficients<T>& q, T w, T x, T y, T z) -> std::array<T, 3>
+  {
+    const auto& [s, vx, vy, vz, mx, my, mz, a] = q;
+
+    const auto aa = a * a;
+    const auto xx = vx * vx;
+    const auto yy = vy * vy;
+    const auto zz = vz * vz;
+    const auto xy = vx * vy;
+    const auto xz = vx * vz;
+    const auto yz = vy * vz;
+    const auto ax = a * vx;
+    const auto ay = a * vy;
+    const auto az = a * vz;
+
+    const auto scale = T{1} / (aa + xx + yy + zz);
+    const auto tw = T{-2} * w;
+
+    const auto tx = tw * (a * mx + my * vz - mz * vy + s * vx);
+    const auto ty = tw * (a * my + mz * vx - mx * vz + s * vy);
+    const auto tz = tw * (a * mz + mx * vy - my * vx + s * vz);
+
+    return {
+        scale * ((aa + xx - yy - zz) * x + T{2} * (xy + az) * y +
+                 T{2} * (xz - ay) * z + tx),
+        scale * (T{2} * (xy - az) * x + (aa - xx + yy - zz) * y +
+                 T{2} * (yz + ax) * z + ty),
+        scale * (T{2} * (xz + ay) * x + T{2} * (yz - ax) * y +
+                 (aa - xx - yy + zz) * z + tz)};
+  }
+
+public:
+  template <class P, std::size_t K, std::unsigned_integral I>
+    requires std::same_as<
+                 std::remove_const_t<P>,
+                 point<algebra_type_t<P>>> and
+             (algebra_dimension_v<algebra_type_t<P>> == 4) and (K != 0)
+  static auto operator()(
+      std::span<const motor<algebra_type_t<P>>> palette,
+      std::span<const std::array<algebra_field_t<algebra_type_t<P>>, K>>
+          weights,
+      std::span<const std::array<I, K>> indices,
+      soa_span<P> vertices,
+      soa_span<point<algebra_type_t<P>>> out,
+      std::size_t thread_count = 1) -> void
+  {
+    using A = algebra_type_t<P>;
+    using T = algebra_field_t<A>;
+
+    detail::precondition(
+        weights.size() == vertices.size() and
+            indices.size() == vertices.size() and
+            out.size() == vertices.size(),
+        [n = vertices.size()] {
+          return detail::contract_violation_handler{
+              "number of weights, indices, and output points must be '{}'",
+              n};
+        });
+
+    const auto in = soa_span<const point<A>>{vertices};
+
+    detail::for_each_partition(
+        out.size(),
+        thread_count,
+        [=](std::size_t offset, std::size_t count) {
+          const auto idx = indices.subspan(offset, count);
+          const auto wts = weights.subspan(offset, count);
+
+          // checked before the loop, see `for_each_partition`
+          auto max_index = I{};
+          for (const auto& bones : idx) {
+            max_index = std::max(max_index, std::ranges::max(bones));
+          }
+          detail::precondition(
+              idx.empty() or max_index < palette.size(),
+              [n = palette.size()] {
+                return detail::contract_violation_handler{
+                    "bone index must be less than '{}'", n};
+              });
+
+          const auto w = in.column(0).subspan(offset, count);
+          const auto x = in.column(1).subspan(offset, count);
+          const auto y = in.column(2).subspan(offset, count);
+          const auto z = in.column(3).subspan(offset, count);
+
+          const auto rw = out.column(0).subspan(offset, count);
+          const auto rx = out.column(1).subspan(offset, count);
+          const auto ry = out.column(2).subspan(offset, count);
+          const auto rz = out.column(3).subspan(offset, count);
+
+          for (auto i = 0UZ; i != count; ++i) {
+            const auto& first = palette[idx[i][0]];
+
+            // `q` and `-q` describe the same motion. Each motor is
+            // blended with the sign that aligns its weight with the weight
+            // of the first motor, so that blending follows the shorter path.
+            auto q = motor_coefficients<T>{};
+            for (auto k = 0UZ; k != K; ++k) {
+              const auto& bone = palette[idx[i][k]];
+
+              const auto dot = bone[1] * first[1] + bone[2] * first[2] +
+                               bone[3] * first[3] + bone[7] * first[7];
+              const auto weight = dot < T{} ? -wts[i][k] : wts[i][k];
+
+              for (auto j = 0UZ; j != q.size(); ++j) {
+                q[j] += weight * bone[j];
+              }
+            }
+
+            const auto [px, py, pz] = sandwich(q, w[i], x[i], y[i], z[i]);
+
+            rw[i] = w[i];
+            rx[i] = px;
+            ry[i] = py;
+            rz[i] = pz;
+          }
+        });
+  }
+};
+
+}  // namespace detail
+
+/// blends bone motors and applies them to mesh vertices
+/// @param palette bone motors
+/// @param weights bone weights of each vertex
+/// @param indices bone indices of each vertex, into `palette`
+/// @param vertices vertices in the rest pose
+/// @param out transformed vertices
+/// @param thread_count maximum number of threads
+///
+/// For each vertex, blends the unit motors `palette[indices[i][k]]` with
+/// weights `weights[i][k]`, normalizes the blended motor, and stores the
+/// transform of `vertices[i]` by it in `out[i]`. This is the motor
+/// counterpart of dual quaternion skinning. Each motor is blended with the
+/// sign that aligns its weight with the weight of the first motor of the
+/// vertex, so that the blend follows the shorter path.
+///
+/// Instead of applying the generic sandwich product, only the blades of a
+/// point are expanded from the blended motor, and normalization is folded
+/// into the result. The weight of each vertex is preserved. Vertices are
+/// partitioned as described by `detail::for_each_partition`.
+///
+/// The blended motor of each vertex must have a nonzero weight, for example
+/// by using nonnegative weights that are not all zero.
+///
+/// @pre `weights.size() == vertices.size()`
+/// @pre `indices.size() == vertices.size()`
+/// @pre `out.size() == vertices.size()`
+/// @pre each index is less than `palette.size()`
+///
+inline constexpr auto skin = detail::skin_fn{};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,234 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/algebra_type.hpp"
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/geometric_fwd.hpp"
+#include "rigid_geometric_algebra/is_multivector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace rigid_geometric_algebra {
+
+/// non-owning structure-of-arrays view of a sequence of values
+/// @tparam T geometric or `multivector` type, optionally const-qualified
+///
+/// Refers to one contiguous array of coefficients for each blade of `T`. The
+/// `i`-th element of the sequence is formed from the `i`-th value of each
+/// array.
+///
+/// Compared to a contiguous sequence of `T`, loops over the elements load and
+/// store each coefficient from contiguous memory, allowing them to be
+/// vectorized.
+///
+template <class T>
+  requires detail::geometric<T> or detail::multivector<T>
+class soa_span
+{
+public:
+  /// element type
+  ///
+  using element_type = T;
+
+  /// element type without cv-qualification
+  ///
+  using value_type = std::remove_cv_t<T>;
+
+  /// coefficient type, const-qualified if `T` is const-qualified
+  ///
+  using coefficient_type = std::conditional_t<
+      std::is_const_v<T>,
+      const algebra_field_t<algebra_type_t<T>>,
+      algebra_field_t<algebra_type_t<T>>>;
+
+  /// number of coefficient arrays
+  ///
+  static constexpr auto rank = value_type::size;
+
+private:
+  std::array<coefficient_type*, rank> data_{};
+  std::size_t size_{};
+
+  static constexpr auto
+  as_multivector(const value_type& value) noexcept -> const auto&
+  {
+    if constexpr (detail::geometric<value_type>) {
+      return value.multivector();
+    } else {
+      return value;
+    }
+  }
+
+public:
+  /// constructs an empty `soa_span`
+  ///
+  soa_span() = default;
+
+  /// constructs a `soa_span` from a range of coefficient arrays
+  /// @tparam R range of contiguous ranges
+  /// @param columns coefficient arrays, one for each blade of `T` in
+  ///   canonical order
+  ///
+  /// @pre `std::ranges::size(columns) == rank`
+  /// @pre each coefficient array has the same size
+  ///
+  template <std::ranges::input_range R>
+    requires std::ranges::sized_range<R> and
+             std::constructible_from<
+                 std::span<coefficient_type>,
+                 std::ranges::range_reference_t<R>>
+  constexpr explicit soa_span(R&& columns)
+  {
+    detail::precondition(
+        std::ranges::size(columns) == rank,
+        [m = std::ranges::size(columns), n = rank()] {
+          return detail::contract_violation_handler{
+              "number of columns '{}' must match the number of coefficients "
+              "'{}'",
+              m,
+              n};
+        });
+
+    auto it = data_.begin();
+    for (auto&& column : columns) {
+      const auto s = std::span<coefficient_type>{column};
+
+      detail::precondition(
+          it == data_.begin() or s.size() == size_,
+          [m = s.size(), n = size_] {
+            return detail::contract_violation_handler{
+                "column size '{}' must match '{}'", m, n};
+          });
+
+      size_ = s.size();
+      *it++ = s.data();
+    }
+  }
+
+  /// converting constructor to a const `soa_span`
+  ///
+  template <class U>
+    requires std::is_same_v<const U, T> and (not std::is_same_v<U, T>)
+  constexpr soa_span(soa_span<U> other) noexcept
+      : data_{[&other]<std::size_t... Is>(std::index_sequence<Is...>) {
+          return std::array<coefficient_type*, rank>{
+              other.column(Is).data()...};
+        }(std::make_index_sequence<rank>{})},
+        size_{other.size()}
+  {}
+
+  /// number of elements
+  ///
+  [[nodiscard]]
+  constexpr auto size() const noexcept -> std::size_t
+  {
+    return size_;
+  }
+
+  /// checks if the sequence is empty
+  ///
+  [[nodiscard]]
+  constexpr auto empty() const noexcept -> bool
+  {
+    return size_ == 0;
+  }
+
+  /// access the coefficient array of a blade
+  /// @param j blade index, in canonical order
+  ///
+  /// @pre `j < rank`
+  ///
+  [[nodiscard]]
+  constexpr auto column(std::size_t j) const -> std::span<coefficient_type>
+  {
+    detail::precondition(j < rank);
+    return {data_[j], size_};
+  }
+
+  /// access the coefficient arrays of all blades
+  ///
+  /// Returns a pointer to the first coefficient of each array, in canonical
+  /// order. Each array has `size()` coefficients.
+  ///
+  [[nodiscard]]
+  constexpr auto data() const noexcept -> std::array<coefficient_type*, rank>
+  {
+    return data_;
+  }
+
+  /// loads an element
+  /// @param i element index
+  ///
+  /// @pre `i < size()`
+  ///
+  [[nodiscard]]
+  constexpr auto operator[](std::size_t i) const -> value_type
+  {
+    detail::precondition(i < size_, [i, n = size_] {
+      return detail::contract_violation_handler{
+          "index value '{}' not less than size '{}'", i, n};
+    });
+
+    return [this, i]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return value_type{data_[Is][i]...};
+    }(std::make_index_sequence<rank>{});
+  }
+
+  /// stores an element
+  /// @param i element index
+  /// @param value value to store
+  ///
+  /// @pre `i < size()`
+  /// @note Requires: `std::is_const_v<T>` is `false`
+  ///
+  constexpr auto store(std::size_t i, const value_type& value) const -> void
+    requires (not std::is_const_v<T>)
+  {
+    detail::precondition(i < size_, [i, n = size_] {
+      return detail::contract_violation_handler{
+          "index value '{}' not less than size '{}'", i, n};
+    });
+
+    [this, i, &v = as_multivector(value)]<std::size_t... Is>(
+        std::index_sequence<Is...>) {
+      ((data_[Is][i] = v.template get<Is>().coefficient), ...);
+    }(std::make_index_sequence<rank>{});
+  }
+
+  /// obtains a view of a subsequence
+  /// @param offset index of the first element
+  /// @param count number of elements
+  ///
+  /// Subsequences are typically used to partition work across threads.
+  ///
+  /// @pre `offset + count <= size()`
+  ///
+  [[nodiscard]]
+  constexpr auto
+  subspan(std::size_t offset, std::size_t count) const -> soa_span
+  {
+    detail::precondition(
+        offset <= size_ and count <= size_ - offset,
+        [offset, count, n = size_] {
+          return detail::contract_violation_handler{
+              "subspan [{}, {} + {}) exceeds size '{}'",
+              offset,
+              offset,
+              count,
+              n};
+        });
+
+    auto s = *this;
+    std::ranges::for_each(s.data_, [offset](auto& p) { p += offset; });
+    s.size_ = count;
+    return s;
+  }
+};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,357 @@
+#pragma once
+
+#include "rigid_geometric_algebra/algebra_dimension.hpp"
+#include "rigid_geometric_algebra/algebra_field.hpp"
+#include "rigid_geometric_algebra/blade_dimensions.hpp"
+#include "rigid_geometric_algebra/detail/cayley_table.hpp"
+#include "rigid_geometric_algebra/detail/contract.hpp"
+#include "rigid_geometric_algebra/detail/dynamic_operator.hpp"
+#include "rigid_geometric_algebra/detail/type_list.hpp"
+#include "rigid_geometric_algebra/geometric_fwd.hpp"
+#include "rigid_geometric_algebra/is_algebra.hpp"
+#include "rigid_geometric_algebra/multivector.hpp"
+#include "rigid_geometric_algebra/sparse_multivector_fwd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+namespace rigid_geometric_algebra {
+
+/// multivector with a runtime set of blades in a fixed algebra
+/// @tparam A algebra type
+///
+/// A `sparse_multivector` stores a bitmask of the blades that are present
+/// and the coefficients of those blades, packed in order of increasing blade
+/// dimension mask. Bit `m` of `blades()` is set if the blade with dimension
+/// mask `m` is present, where bit `i` of a dimension mask is set if the blade
+/// contains `blade<A, i>`. As with `multivector`, coefficients refer to
+/// blades with dimensions in canonical order, e.g. `e31` rather than `e13`.
+///
+/// Unlike `multivector`, the set of blades is determined at run time, which
+/// is useful for general elements where only a few coefficients are nonzero
+/// and which ones depends on data.
+///
+/// ```
+/// using G3 = algebra<double, 3>;
+///
+/// const auto p = sparse_multivector<G3>{G3::point{1, 2, 3, 4}};
+/// const auto q = sparse_multivector<G3>{G3::point{0, 1, 0, 1}};
+///
+/// const auto l = static_cast<G3::line::multivector_type>(wedge(p, q));
+/// ```
+///
+/// `geometric_product`, `geometric_antiproduct`, `wedge`, and `antiwedge`
+/// iterate over the set bits of both operands and look up products in the
+/// Cayley tables used by `dynamic_multivector`.
+///
+/// Algebra dimensions up to 6 are supported.
+///
+template <class A>
+  requires is_algebra_v<A>
+class sparse_multivector
+{
+  static constexpr auto dimension = algebra_dimension_v<A>;
+
+  static_assert(
+      dimension <= 6, "blades of the algebra must fit in a 64-bit bitmask");
+
+public:
+  /// algebra type
+  ///
+  using algebra_type = A;
+
+  /// field type
+  ///
+  using value_type = algebra_field_t<A>;
+
+  /// bitmask of present blades
+  ///
+  using mask_type = std::uint64_t;
+
+  /// number of blades in the algebra
+  ///
+  static constexpr auto max_size = std::size_t{1} << dimension;
+
+private:
+  template <detail::cayley_product>
+  friend class detail::dynamic_operator;
+
+  mask_type blades_{};
+  std::array<value_type, max_size> coefficients_{};
+
+  static constexpr auto bit(std::size_t mask) -> mask_type
+  {
+    return mask_type{1} << mask;
+  }
+
+  // lowest set bit of a nonzero bitmask
+  static constexpr auto lowest(mask_type bits) -> std::size_t
+  {
+    return static_cast<std::size_t>(std::countr_zero(bits));
+  }
+
+  // position of a present blade in `coefficients_`
+  [[nodiscard]]
+  constexpr auto index(std::size_t mask) const -> std::size_t
+  {
+    return static_cast<std::size_t>(
+        std::popcount(blades_ & (bit(mask) - 1)));
+  }
+
+  // constructs from coefficients indexed by blade mask
+  static constexpr auto
+  pack(mask_type blades, std::array<value_type, max_size>& dense)
+      -> sparse_multivector
+  {
+    auto x = sparse_multivector{};
+    x.blades_ = blades;
+
+    auto i = 0UZ;
+    for (auto bits = blades; bits != 0; bits &= bits - 1) {
+      x.coefficients_[i++] = std::move(dense[lowest(bits)]);
+    }
+    return x;
+  }
+
+  // merges the blades of `x` and `y`, applying `f` to coefficients of blades
+  // in both and `g` to coefficients of blades only in `y`
+  template <class F, class G>
+  static constexpr auto
+  merge(const sparse_multivector& x, const sparse_multivector& y, F f, G g)
+      -> sparse_multivector
+  {
+    auto z = sparse_multivector{};
+    z.blades_ = x.blades_ | y.blades_;
+
+    auto i = 0UZ;
+    auto j = 0UZ;
+    auto k = 0UZ;
+    for (auto bits = z.blades_; bits != 0; bits &= bits - 1) {
+      const auto b = bit(lowest(bits));
+      const auto in_x = (x.blades_ & b) != 0;
+      const auto in_y = (y.blades_ & b) != 0;
+
+      if (in_x and in_y) {
+        z.coefficients_[k++] =
+            f(x.coefficients_[i++], y.coefficients_[j++]);
+      } else if (in_x) {
+        z.coefficients_[k++] = x.coefficients_[i++];
+      } else {
+        z.coefficients_[k++] = g(y.coefficients_[j++]);
+      }
+    }
+    return z;
+  }
+
+  template <detail::cayley_product P>
+  static auto product(const sparse_multivector& x, const sparse_multivector& y)
+      -> sparse_multivector
+  {
+    const auto& tables = detail::cached_cayley_tables<dimension>();
+
+    // accumulate products of blade pairs by blade mask
+    auto sums = std::array<value_type, max_size>{};
+    auto present = mask_type{};
+
+    auto i = 0UZ;
+    for (auto bx = x.blades_; bx != 0; bx &= bx - 1, ++i) {
+      const auto m1 = static_cast<std::uint8_t>(lowest(bx));
+
+      auto j = 0UZ;
+      for (auto by = y.blades_; by != 0; by &= by - 1, ++j) {
+        const auto m2 = static_cast<std::uint8_t>(lowest(by));
+
+        const auto e = tables(P, m1, m2);
+        if (e.sign == 0) {
+          continue;
+        }
+
+        auto c = x.coefficients_[i] * y.coefficients_[j];
+        if (e.sign < 0) {
+          c = -c;
+        }
+        sums[e.mask] =
+            (present & bit(e.mask)) != 0 ? sums[e.mask] + c : std::move(c);
+        present |= bit(e.mask);
+      }
+    }
+
+    return pack(present, sums);
+  }
+
+public:
+  /// constructs a multivector without blades
+  ///
+  sparse_multivector() = default;
+
+  /// constructs from a `multivector`
+  ///
+  template <blade_dimensions... D>
+  constexpr explicit sparse_multivector(const multivector<A, D...>& v)
+  {
+    auto dense = std::array<value_type, max_size>{};
+    auto blades = mask_type{};
+
+    [&dense, &blades, &v]<class... Bs>(detail::type_list<Bs...>) {
+      ((dense[Bs::dimension_mask.to_unsigned()] =
+            v.template get<Bs>().coefficient,
+        blades |= bit(Bs::dimension_mask.to_unsigned())),
+       ...);
+    }(typename multivector<A, D...>::blade_list_type{});
+
+    *this = pack(blades, dense);
+  }
+
+  /// constructs from a geometric type
+  ///
+  template <detail::geometric G>
+    requires std::constructible_from<
+        sparse_multivector,
+        const typename G::multivector_type&>
+  constexpr explicit sparse_multivector(const G& g)
+      : sparse_multivector{g.multivector()}
+  {}
+
+  /// converts to a `multivector`
+  ///
+  /// @pre each present blade is a blade of `multivector<A, D...>`
+  ///
+  template <blade_dimensions... D>
+  constexpr explicit operator multivector<A, D...>() const
+  {
+    using V = multivector<A, D...>;
+
+    constexpr auto target = []<class... Bs>(detail::type_list<Bs...>) {
+      return (bit(Bs::dimension_mask.to_unsigned()) | ... | mask_type{});
+    }(typename V::blade_list_type{});
+
+    detail::precondition(
+        (blades_ & ~target) == 0, [extra = blades_ & ~target] {
+          return detail::contract_violation_handler{
+              "blades '{:#b}' are not blades of the target multivector",
+              extra};
+        });
+
+    auto v = V{};
+    [this, &v]<class... Bs>(detail::type_list<Bs...>) {
+      ((v.template get<Bs>().coefficient =
+            coefficient(Bs::dimension_mask.to_unsigned())),
+       ...);
+    }(typename V::blade_list_type{});
+    return v;
+  }
+
+  /// bitmask of present blades
+  ///
+  [[nodiscard]]
+  constexpr auto blades() const noexcept -> mask_type
+  {
+    return blades_;
+  }
+
+  /// number of present blades
+  ///
+  [[nodiscard]]
+  constexpr auto size() const noexcept -> std::size_t
+  {
+    return static_cast<std::size_t>(std::popcount(blades_));
+  }
+
+  /// coefficients of present blades, in order of increasing blade mask
+  ///
+  [[nodiscard]]
+  constexpr auto coefficients() const noexcept -> std::span<const value_type>
+  {
+    return {coefficients_.data(), size()};
+  }
+
+  /// coefficient of a blade, or zero if the blade is not present
+  /// @param mask blade dimension mask
+  ///
+  /// @pre `mask < max_size`
+  ///
+  [[nodiscard]]
+  constexpr auto coefficient(std::size_t mask) const -> value_type
+  {
+    detail::precondition(mask < max_size, [mask] {
+      return detail::contract_violation_handler{
+          "blade mask '{:#b}' exceeds algebra dimension '{}'",
+          mask,
+          dimension};
+    });
+
+    return (blades_ & bit(mask)) != 0 ? coefficients_[index(mask)]
+                                      : value_type{};
+  }
+
+  /// vector space operations
+  ///
+  /// Addition and subtraction store the union of the blades of both operands.
+  ///
+  /// @{
+
+  friend constexpr auto operator-(const sparse_multivector& x)
+      -> sparse_multivector
+  {
+    auto y = x;
+    for (auto& c : std::span{y.coefficients_}.first(x.size())) {
+      c = -c;
+    }
+    return y;
+  }
+
+  friend constexpr auto
+  operator+(const sparse_multivector& x, const sparse_multivector& y)
+      -> sparse_multivector
+  {
+    return merge(
+        x,
+        y,
+        [](const value_type& a, const value_type& b) { return a + b; },
+        [](const value_type& b) { return b; });
+  }
+
+  friend constexpr auto
+  operator-(const sparse_multivector& x, const sparse_multivector& y)
+      -> sparse_multivector
+  {
+    return merge(
+        x,
+        y,
+        [](const value_type& a, const value_type& b) { return a - b; },
+        [](const value_type& b) { return -b; });
+  }
+
+  friend constexpr auto
+  operator*(const value_type& s, const sparse_multivector& x)
+      -> sparse_multivector
+  {
+    auto y = x;
+    for (auto& c : std::span{y.coefficients_}.first(x.size())) {
+      c = s * c;
+    }
+    return y;
+  }
+
+  /// @}
+
+  /// equality comparison
+  ///
+  /// Multivectors are equal if they store the same blades with equal
+  /// coefficients.
+  ///
+  friend constexpr auto
+  operator==(const sparse_multivector& x, const sparse_multivector& y) -> bool
+  {
+    return x.blades_ == y.blades_ and
+           std::ranges::equal(x.coefficients(), y.coefficients());
+  }
+};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "rigid_geometric_algebra/is_algebra.hpp"
+
+namespace rigid_geometric_algebra {
+
+// forward declaration
+//
+template <class A>
+  requires is_algebra_v<A>
+class sparse_multivector;
+
+}  // namespace rigid_geometric_algebra
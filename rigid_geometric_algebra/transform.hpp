@@ -0,0 +1,68 @@
+#pragma once
+
+#include "rigid_geometric_algebra/detail/derive_soa_overload.hpp"
+#include "rigid_geometric_algebra/detail/geometric_operator.hpp"
+#include "rigid_geometric_algebra/detail/type_list.hpp"
+#include "rigid_geometric_algebra/geometric_antiproduct.hpp"
+#include "rigid_geometric_algebra/get.hpp"
+#include "rigid_geometric_algebra/is_multivector.hpp"
+#include "rigid_geometric_algebra/reverse.hpp"
+
+#include <type_traits>
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class transform_value_fn : public detail::geometric_operator
+{
+public:
+  using detail::geometric_operator::operator();
+
+  template <detail::multivector Q, detail::multivector V>
+    requires std::is_invocable_v<
+        decltype(geometric_antiproduct),
+        std::invoke_result_t<
+            decltype(geometric_antiproduct),
+            const Q&,
+            const V&>,
+        std::invoke_result_t<decltype(antireverse), const Q&>>
+  static constexpr auto operator()(const Q& q, const V& x) -> V
+  {
+    const auto y = geometric_antiproduct(
+        geometric_antiproduct(q, x), antireverse(q));
+
+    // blades outside of `V` cancel for a unit motor
+    return [&y]<class... Bs>(detail::type_list<Bs...>) {
+      return V{get<Bs>(y)...};
+    }(typename V::blade_list_type{});
+  }
+};
+
+class transform_fn : public transform_value_fn,
+                     public derive_soa_overload<transform_value_fn>
+{
+public:
+  using transform_value_fn::operator();
+  using derive_soa_overload<transform_value_fn>::operator();
+};
+
+}  // namespace detail
+
+/// applies a rigid motion
+/// @param q unit motor
+/// @param x transformed element
+///
+/// Returns the sandwich product
+/// ```
+/// geometric_antiproduct(geometric_antiproduct(q, x), antireverse(q))
+/// ```
+/// restricted to the blades of `x`, so that the result has the same type as
+/// `x`.
+///
+/// Batches may be transformed with `transform(qs, xs, out)` or, by a single
+/// motor, with `transform(q, xs, out)`, where `qs`, `xs`, and `out` are
+/// `soa_span`s.
+///
+inline constexpr auto transform = detail::transform_fn{};
+
+}  // namespace rigid_geometric_algebra
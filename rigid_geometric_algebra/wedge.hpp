@@ -2,9 +2,10 @@
 
 #include "rigid_geometric_algebra/blade_type_from.hpp"
 #include "rigid_geometric_algebra/common_algebra_type.hpp"
-#include "rigid_geometric_algebra/detail/concat_ranges.hpp"
-#include "rigid_geometric_algebra/detail/counted_sort.hpp"
+#include "rigid_geometric_algebra/detail/derive_soa_overload.hpp"
+#include "rigid_geometric_algebra/detail/dynamic_operator.hpp"
 #include "rigid_geometric_algebra/detail/geometric_operator.hpp"
+#include "rigid_geometric_algebra/detail/inversion_count.hpp"
 #include "rigid_geometric_algebra/detail/linear_operator.hpp"
 #include "rigid_geometric_algebra/detail/negate_if_odd.hpp"
 #include "rigid_geometric_algebra/is_blade.hpp"
@@ -44,10 +45,10 @@ public:
   static constexpr auto operator()(B1&& b1, B2&& b2) -> blade_result_t<B1, B2>
   {
     static constexpr auto num_swaps =
-        detail::counted_sort(detail::concat_ranges(
+        detail::inversion_count(
             std::remove_cvref_t<B1>::dimensions,
-            std::remove_cvref_t<B2>::dimensions)) +
-        detail::counted_sort(auto{blade_result_t<B1, B2>::dimensions});
+            std::remove_cvref_t<B2>::dimensions) +
+        detail::inversion_count(blade_result_t<B1, B2>::dimensions);
 
     return blade_result_t<B1, B2>{detail::negate_if_odd<num_swaps>{}(
         std::forward<B1>(b1).coefficient * std::forward<B2>(b2).coefficient)};
@@ -63,7 +64,7 @@ public:
   }
 };
 
-class wedge_fn
+class wedge_value_fn
     : public detail::linear_operator<detail::wedge_blade_fn>,
       public detail::geometric_operator
 {
@@ -72,10 +73,23 @@ public:
   using detail::geometric_operator::operator();
 };
 
+class wedge_fn : public wedge_value_fn,
+                 public derive_soa_overload<wedge_value_fn>,
+                 public dynamic_operator<cayley_product::wedge>
+{
+public:
+  using wedge_value_fn::operator();
+  using derive_soa_overload<wedge_value_fn>::operator();
+  using dynamic_operator<cayley_product::wedge>::operator();
+};
+
 }  // namespace detail
 
 /// wedge product
 ///
+/// Batches may be combined with `wedge(as, bs, out)`, where `as`, `bs`, and
+/// `out` are `soa_span`s.
+///
 /// @see sec. 2.1.1
 ///
 inline constexpr auto wedge = detail::wedge_fn{};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "rigid_geometric_algebra/antiwedge.hpp"
+#include "rigid_geometric_algebra/detail/derive_soa_overload.hpp"
+#include "rigid_geometric_algebra/detail/geometric_operator.hpp"
+#include "rigid_geometric_algebra/dual.hpp"
+
+namespace rigid_geometric_algebra {
+namespace detail {
+
+class weight_contraction_value_fn : public detail::geometric_operator
+{
+public:
+  using detail::geometric_operator::operator();
+
+  template <class T1, class T2>
+  static constexpr auto operator()(const T1& a, const T2& b)
+      -> decltype(antiwedge(a, weight_dual(b)))
+  {
+    return antiwedge(a, weight_dual(b));
+  }
+};
+
+class weight_contraction_fn
+    : public weight_contraction_value_fn,
+      public derive_soa_overload<weight_contraction_value_fn>
+{
+public:
+  using weight_contraction_value_fn::operator();
+  using derive_soa_overload<weight_contraction_value_fn>::operator();
+};
+
+}  // namespace detail
+
+/// weight contraction
+///
+/// Returns `antiwedge(a, weight_dual(b))`, the element contained in `a` that
+/// is orthogonal to `b`. For example, the weight contraction of a plane onto a
+/// point is the line at infinity of the plane.
+///
+/// Batches may be contracted with `weight_contraction(as, bs, out)` or, onto
+/// a single element, with `weight_contraction(as, b, out)`, where `as`, `bs`,
+/// and `out` are `soa_span`s.
+///
+/// @see antiproject
+///
+inline constexpr auto weight_contraction = detail::weight_contraction_fn{};
+
+}  // namespace rigid_geometric_algebra
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace support {
+
+/// allocates zero-initialized coefficient columns for a `soa_span`
+/// @tparam T multivector or geometric type stored in the `soa_span`
+/// @param n number of elements
+///
+/// Returns an array of `T::size` columns, each holding `n` `double`s.
+///
+template <class T>
+auto columns(std::size_t n) -> std::array<std::vector<double>, T::size>
+{
+  auto c = std::array<std::vector<double>, T::size>{};
+  for (auto& column : c) {
+    column.resize(n);
+  }
+  return c;
+}
+
+}  // namespace support
@@ -0,0 +1,67 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include <array>
+#include <vector>
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+  using magnitude = ::rigid_geometric_algebra::homogeneous_magnitude_t<G3>;
+
+  using ::rigid_geometric_algebra::angle;
+  using ::rigid_geometric_algebra::homogeneous_magnitude;
+  using ::rigid_geometric_algebra::soa_span;
+
+  "line to line"_test = [] {
+    const auto k = G3::line{2, 0, 0, 0, 0, 0};
+    const auto l = G3::line{3, 4, 0, 0, 0, 0};
+
+    return expect(
+        eq(homogeneous_magnitude<G3>(6, 10), angle(k, l)) and
+        eq(homogeneous_magnitude<G3>(-6, 10),
+           angle(G3::line{-2, 0, 0, 0, 0, 0}, l)));
+  };
+
+  "plane to plane"_test = [] {
+    const auto g = G3::plane{0, 0, 1, -1};
+    const auto h = G3::plane{0, 3, 4, 7};
+
+    return expect(eq(homogeneous_magnitude<G3>(4, 5), angle(g, h)));
+  };
+
+  "line to plane"_test = [] {
+    const auto l = G3::line{0, 3, 4, 0, 0, 0};
+    const auto g = G3::plane{0, 0, 1, -1};
+
+    return expect(
+        eq(homogeneous_magnitude<G3>(3, 5), angle(l, g)) and
+        eq(angle(l, g), angle(g, l)));
+  };
+
+  "batched angles between lines"_test = [] {
+    auto ks = std::array<std::vector<double>, G3::line::size>{
+        std::vector{1., 0.},
+        std::vector{0., 1.},
+        std::vector{0., 0.},
+        std::vector{0., 0.},
+        std::vector{0., 0.},
+        std::vector{0., 0.}};
+    auto out = std::array<std::vector<double>, magnitude::size>{};
+    for (auto& column : out) {
+      column.resize(2);
+    }
+
+    const auto as = soa_span<magnitude>{out};
+
+    angle(soa_span<const G3::line>{ks}, G3::line{1, 0, 0, 0, 0, 0}, as);
+
+    return expect(
+        eq(homogeneous_magnitude<G3>(1, 1), as[0]) and
+        eq(homogeneous_magnitude<G3>(0, 1), as[1]));
+  };
+}
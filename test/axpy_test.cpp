@@ -0,0 +1,102 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include "test/skytest_ext.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::eq;
+  using ::skytest::equal_ranges;
+  using ::skytest::expect;
+
+  using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+  using ::rigid_geometric_algebra::axpy;
+  using ::rigid_geometric_algebra::counted;
+  using ::rigid_geometric_algebra::soa_span;
+
+  "fma of blades"_ctest = [] {
+    return expect(
+        eq(G3::blade<1>{7}, fma(2., G3::blade<1>{3}, G3::blade<1>{1})));
+  };
+
+  "fma of multivectors"_ctest = [] {
+    const auto x = G3::point{1, 2, 3, 4}.multivector();
+    const auto y = G3::point{1, 1, 1, 1}.multivector();
+
+    return expect(eq(2. * x + y, fma(2., x, y)));
+  };
+
+  "axpy of geometric types"_ctest = [] {
+    return expect(eq(
+        G3::point{3, -1, 7, 1},
+        axpy(2., G3::point{1, 0, 3, 1}, G3::point{1, -1, 1, -1})));
+  };
+
+  "axpy rounds floating-point coefficients once with a fast fma"_test = [] {
+    const auto a = 1. - 0x1p-27;
+    const auto x = G3::blade<>{1. + 0x1p-27};
+    const auto y = G3::blade<>{-1.};
+
+    // `std::fma` is only used if the target reports a fast `fma`
+#ifdef FP_FAST_FMA
+    constexpr auto expected = -0x1p-54;
+#else
+    constexpr auto expected = 0.;
+#endif
+
+    return expect(
+        eq(0., (a * x + y).coefficient) and
+        eq(expected, axpy(a, x, y).coefficient));
+  };
+
+  "axpy computes each coefficient once"_test = [] {
+    using C = counted<double>;
+    using A = ::rigid_geometric_algebra::algebra<C, 3>;
+
+    const auto x = A::point{C{1}, C{2}, C{3}, C{4}};
+    const auto y = A::point{C{1}, C{1}, C{1}, C{1}};
+
+    C::reset();
+    static_cast<void>(axpy(C{2}, x, y));
+
+    return expect(eq(
+        ::rigid_geometric_algebra::operation_counts{
+            .additions = 4, .multiplications = 4},
+        C::counts()));
+  };
+
+  "axpy updates spans of elements"_test = [] {
+    const auto xs = std::vector{G3::point{1, 0, 0, 1}, G3::point{0, 1, 0, 1}};
+    auto ys = std::vector{G3::point{1, 1, 1, 1}, G3::point{2, 2, 2, 2}};
+
+    axpy(3., std::span{xs}, std::span{ys});
+
+    return expect(equal_ranges(
+        std::vector{G3::point{4, 1, 1, 4}, G3::point{2, 5, 2, 5}}, ys));
+  };
+
+  "axpy updates soa_spans of elements"_test = [] {
+    const auto x_columns = std::array{
+        std::array{1., 0.}, std::array{0., 1.}, std::array{0., 0.},
+        std::array{1., 1.}};
+    auto y_columns = std::array{
+        std::array{1., 2.}, std::array{1., 2.}, std::array{1., 2.},
+        std::array{1., 2.}};
+
+    axpy(
+        3.,
+        soa_span<const G3::point>{x_columns},
+        soa_span<G3::point>{y_columns});
+
+    return expect(
+        equal_ranges(std::array{4., 2.}, y_columns[0]) and
+        equal_ranges(std::array{1., 5.}, y_columns[1]) and
+        equal_ranges(std::array{1., 2.}, y_columns[2]) and
+        equal_ranges(std::array{4., 5.}, y_columns[3]));
+  };
+}
@@ -0,0 +1,183 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+#include "support/soa_columns.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using ::rigid_geometric_algebra::closest_points;
+using ::rigid_geometric_algebra::soa_span;
+using ::support::columns;
+
+using vector = std::array<double, 3>;
+
+auto position(const G3::point& p) -> vector
+{
+  return {p[1] / p[0], p[2] / p[0], p[3] / p[0]};
+}
+
+auto cross(const vector& a, const vector& b) -> vector
+{
+  return {
+      a[1] * b[2] - a[2] * b[1],
+      a[2] * b[0] - a[0] * b[2],
+      a[0] * b[1] - a[1] * b[0]};
+}
+
+auto dot(const vector& a, const vector& b) -> double
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+auto near(const vector& a, const vector& b) -> bool
+{
+  return std::abs(a[0] - b[0]) < 1e-9 and std::abs(a[1] - b[1]) < 1e-9 and
+         std::abs(a[2] - b[2]) < 1e-9;
+}
+
+// checks that `p` lies on `l`, with `x * v == m` for a position `x` on a
+// line with direction `v` and moment `m`
+auto on_line(const G3::point& p, const G3::line& l) -> bool
+{
+  return near(
+      cross(position(p), vector{l[0], l[1], l[2]}),
+      vector{l[3], l[4], l[5]});
+}
+
+// lines through pairs of random points with random weights
+auto random_lines(std::size_t n, unsigned seed) -> std::vector<G3::line>
+{
+  auto rng = std::mt19937{seed};
+  auto dist = std::uniform_real_distribution{-1.0, 1.0};
+  auto weight = std::uniform_real_distribution{0.5, 2.0};
+
+  const auto point = [&] {
+    const auto w = weight(rng);
+    return G3::point{w, w * dist(rng), w * dist(rng), w * dist(rng)};
+  };
+
+  auto lines = std::vector<G3::line>{};
+  for (auto i = 0UZ; i != n; ++i) {
+    lines.push_back(point() ^ point());
+  }
+  return lines;
+}
+
+}  // namespace
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::aborts;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  "skew lines"_test = [] {
+    // x axis and the line through (0, 0, 2) in the y direction
+    const auto k = G3::line{1, 0, 0, 0, 0, 0};
+    const auto l = G3::point{1, 0, 0, 2} ^ G3::point{1, 0, 3, 2};
+
+    const auto [p, q] = closest_points(k, l);
+
+    return expect(
+        eq(G3::point{9, 0, 0, 0}, p) and eq(G3::point{9, 0, 0, 18}, q));
+  };
+
+  "closest points lie on a common perpendicular"_test = [] {
+    const auto ks = random_lines(100, 0);
+    const auto ls = random_lines(100, 1);
+
+    auto failures = 0UZ;
+    for (auto i = 0UZ; i != ks.size(); ++i) {
+      const auto& k = ks[i];
+      const auto& l = ls[i];
+      const auto [p, q] = closest_points(k, l);
+
+      const auto d = vector{
+          position(q)[0] - position(p)[0],
+          position(q)[1] - position(p)[1],
+          position(q)[2] - position(p)[2]};
+
+      failures += std::size_t(
+          not on_line(p, k) or not on_line(q, l) or
+          std::abs(dot(d, vector{k[0], k[1], k[2]})) > 1e-9 or
+          std::abs(dot(d, vector{l[0], l[1], l[2]})) > 1e-9);
+    }
+
+    return expect(eq(0UZ, failures));
+  };
+
+  "parallel lines"_test = [] {
+    // lines in the x direction through (1, 2, 0) and (0, 0, 2)
+    const auto k = G3::point{1, 1, 2, 0} ^ G3::point{1, 3, 2, 0};
+    const auto l = G3::point{2, 0, 0, 4} ^ G3::point{2, 2, 0, 4};
+    // a line through (0, 2, 0) within the tolerance of the x direction
+    const auto m = G3::point{1, 0, 2, 0} ^ G3::point{1, 1, 2, 1e-9};
+
+    const auto [p1, q1] = closest_points(k, l);
+    const auto [p2, q2] = closest_points(m, l);
+
+    return expect(
+        near(vector{0, 2, 0}, position(p1)) and
+        near(vector{0, 0, 2}, position(q1)) and
+        near(vector{0, 2, 0}, position(p2)) and
+        near(vector{0, 0, 2}, position(q2)) and p1[0] > 0 and q1[0] > 0);
+  };
+
+  "batches match single pairs"_test = [] {
+    constexpr auto n = 37UZ;
+
+    const auto ks = random_lines(n, 2);
+    auto ls = random_lines(n, 3);
+    ls[5] = ks[5];
+    ls[7] = G3::line{ks[7][0], ks[7][1], ks[7][2], 0, 0, 0};
+
+    auto k_columns = columns<G3::line>(n);
+    auto l_columns = columns<G3::line>(n);
+    auto p_columns = columns<G3::point>(n);
+    auto q_columns = columns<G3::point>(n);
+
+    for (auto i = 0UZ; i != n; ++i) {
+      soa_span<G3::line>{k_columns}.store(i, ks[i]);
+      soa_span<G3::line>{l_columns}.store(i, ls[i]);
+    }
+
+    const auto ps = soa_span<G3::point>{p_columns};
+    const auto qs = soa_span<G3::point>{q_columns};
+
+    closest_points(
+        soa_span<const G3::line>{k_columns},
+        soa_span<const G3::line>{l_columns},
+        ps,
+        qs);
+
+    auto mismatches = 0UZ;
+    for (auto i = 0UZ; i != n; ++i) {
+      const auto [p, q] = closest_points(ks[i], ls[i]);
+      mismatches += std::size_t(p != ps[i] or q != qs[i]);
+    }
+
+    return expect(eq(0UZ, mismatches));
+  };
+
+  "aborts on mismatched batch sizes"_test = [] {
+    return aborts([] {
+      auto k_columns = columns<G3::line>(2);
+      auto l_columns = columns<G3::line>(2);
+      auto p_columns = columns<G3::point>(2);
+      auto q_columns = columns<G3::point>(1);
+
+      closest_points(
+          soa_span<G3::line>{k_columns},
+          soa_span<G3::line>{l_columns},
+          soa_span<G3::point>{p_columns},
+          soa_span<G3::point>{q_columns});
+    });
+  };
+}
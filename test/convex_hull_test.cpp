@@ -0,0 +1,229 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <span>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using ::rigid_geometric_algebra::antiwedge;
+using ::rigid_geometric_algebra::convex_hull;
+using ::rigid_geometric_algebra::convex_hull_workspace;
+using ::rigid_geometric_algebra::halfspace_intersection;
+using ::rigid_geometric_algebra::weight_norm;
+using ::rigid_geometric_algebra::wedge;
+
+// signed distance from a plane to a point
+auto distance(const G3::plane& g, const G3::point& p) -> double
+{
+  return antiwedge(g.multivector(), p.multivector())
+             .template get<0>()
+             .coefficient /
+         (weight_norm(g) * p[0]);
+}
+
+// number of points above any face of a hull
+auto outside_count(
+    std::span<const G3::plane> planes, std::span<const G3::point> points)
+    -> std::size_t
+{
+  return static_cast<std::size_t>(
+      std::ranges::count_if(points, [planes](const auto& p) {
+        return std::ranges::any_of(
+            planes, [&p](const auto& g) { return distance(g, p) > 1e-12; });
+      }));
+}
+
+// number of distinct vertices of the faces of a hull
+auto vertex_count(const convex_hull_workspace<G3>& workspace) -> std::size_t
+{
+  auto vertices = std::set<std::size_t>{};
+  for (const auto& t : workspace.triangles()) {
+    vertices.insert(t.begin(), t.end());
+  }
+  return vertices.size();
+}
+
+// points in a ball of radius 2 centered at (1, 2, 3), with varying weights
+auto random_points(std::size_t n) -> std::vector<G3::point>
+{
+  auto rng = std::mt19937{0};
+  auto dist = std::uniform_real_distribution{-1.0, 1.0};
+  auto weight = std::uniform_real_distribution{0.5, 2.0};
+
+  auto points = std::vector<G3::point>{};
+  while (points.size() != n) {
+    const auto x = dist(rng);
+    const auto y = dist(rng);
+    const auto z = dist(rng);
+    if (x * x + y * y + z * z <= 1.0) {
+      const auto w = weight(rng);
+      points.push_back(G3::point{
+          w, w * (1.0 + 2.0 * x), w * (2.0 + 2.0 * y), w * (3.0 + 2.0 * z)});
+    }
+  }
+  return points;
+}
+
+}  // namespace
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::aborts;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  "hull of a cube"_test = [] {
+    auto points = std::vector<G3::point>{};
+    for (const auto x : {0., 1.}) {
+      for (const auto y : {0., 1.}) {
+        for (const auto z : {0., 1.}) {
+          points.push_back(G3::point{1, x, y, z});
+        }
+      }
+    }
+    points.push_back(G3::point{2, 1, 1, 1});
+    points.push_back(G3::point{1, 0.25, 0.5, 0.75});
+
+    auto workspace = convex_hull_workspace<G3>{};
+    const auto planes = convex_hull(points, workspace);
+
+    // each face has a vertex opposite to it
+    auto faces_below = 0UZ;
+    for (const auto& g : planes) {
+      faces_below += std::size_t(
+          std::ranges::any_of(points, [&g](const auto& p) {
+            return distance(g, p) < -0.5;
+          }));
+    }
+
+    return expect(
+        eq(12UZ, planes.size()) and eq(12UZ, workspace.triangles().size()) and
+        eq(8UZ, vertex_count(workspace)) and
+        eq(0UZ, outside_count(planes, points)) and eq(12UZ, faces_below));
+  };
+
+  "face planes are the wedge of their vertices"_test = [] {
+    const auto points = random_points(200);
+
+    auto workspace = convex_hull_workspace<G3>{};
+    const auto planes = convex_hull(points, workspace);
+
+    auto mismatches = 0UZ;
+    for (auto i = 0UZ; i != planes.size(); ++i) {
+      const auto [a, b, c] = workspace.triangles()[i];
+      mismatches += std::size_t(
+          planes[i] != wedge(wedge(points[a], points[b]), points[c]));
+    }
+
+    return expect(eq(0UZ, mismatches));
+  };
+
+  "hull of random points is closed and contains all points"_test = [] {
+    const auto points = random_points(5000);
+
+    auto workspace = convex_hull_workspace<G3>{points.size()};
+    const auto planes = convex_hull(points, workspace);
+
+    // Euler's formula for a closed triangulated surface
+    return expect(
+        eq(2 * vertex_count(workspace) - 4, planes.size()) and
+        eq(0UZ, outside_count(planes, points)));
+  };
+
+  "workspace is reused"_test = [] {
+    const auto small = random_points(100);
+    const auto large = random_points(1000);
+
+    auto workspace = convex_hull_workspace<G3>{};
+
+    const auto first = convex_hull(small, workspace);
+    const auto expected = std::vector<G3::plane>(first.begin(), first.end());
+    static_cast<void>(convex_hull(large, workspace));
+    const auto planes = convex_hull(small, workspace);
+
+    return expect(std::ranges::equal(expected, planes));
+  };
+
+  "coplanar points have no hull"_test = [] {
+    const auto points = std::vector{
+        G3::point{1, 0, 0, 0},
+        G3::point{1, 1, 0, 0},
+        G3::point{1, 0, 1, 0},
+        G3::point{1, 1, 1, 0},
+        G3::point{2, 1, 1, 0}};
+
+    auto workspace = convex_hull_workspace<G3>{};
+
+    return expect(
+        eq(0UZ, convex_hull(points, workspace).size()) and
+        eq(0UZ, convex_hull(std::span(points).first(3), workspace).size()));
+  };
+
+  "points require a positive weight"_test = [] {
+    return aborts([] {
+      const auto points = std::vector{
+          G3::point{1, 0, 0, 0},
+          G3::point{1, 1, 0, 0},
+          G3::point{1, 0, 1, 0},
+          G3::point{0, 0, 0, 1}};
+
+      auto workspace = convex_hull_workspace<G3>{};
+      static_cast<void>(convex_hull(points, workspace));
+    });
+  };
+
+  "intersection of the half-spaces of a cube"_test = [] {
+    // |x| <= 1, |y| <= 1, |z| <= 1, and a redundant half-space z <= 2
+    const auto planes = std::vector{
+        G3::plane{1, 0, 0, -1},
+        G3::plane{-1, 0, 0, -1},
+        G3::plane{0, 1, 0, -1},
+        G3::plane{0, -1, 0, -1},
+        G3::plane{0, 0, 1, -1},
+        G3::plane{0, 0, -1, -1},
+        G3::plane{0, 0, 1, -2}};
+
+    auto workspace = convex_hull_workspace<G3>{};
+    const auto vertices =
+        halfspace_intersection(planes, G3::point{2, 0.2, 0.4, -0.2}, workspace);
+
+    auto corners = 0UZ;
+    for (const auto& v : vertices) {
+      corners += std::size_t(
+          v[0] > 0. and std::abs(std::abs(v[1] / v[0]) - 1.) < 1e-12 and
+          std::abs(std::abs(v[2] / v[0]) - 1.) < 1e-12 and
+          std::abs(std::abs(v[3] / v[0]) - 1.) < 1e-12);
+    }
+
+    auto redundant = 0UZ;
+    for (const auto& t : workspace.triangles()) {
+      redundant += std::size_t(std::ranges::find(t, 6UZ) != t.end());
+    }
+
+    return expect(
+        eq(8UZ, vertices.size()) and eq(8UZ, corners) and eq(0UZ, redundant));
+  };
+
+  "interior point must be inside each half-space"_test = [] {
+    return aborts([] {
+      const auto planes = std::vector{
+          G3::plane{1, 0, 0, -1},
+          G3::plane{-1, 0, 0, -1},
+          G3::plane{0, 1, 0, -1},
+          G3::plane{0, -1, 0, -1}};
+
+      auto workspace = convex_hull_workspace<G3>{};
+      static_cast<void>(
+          halfspace_intersection(planes, G3::point{1, 2, 0, 0}, workspace));
+    });
+  };
+}
@@ -0,0 +1,105 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include <functional>
+#include <thread>
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using ::rigid_geometric_algebra::algebra;
+  using ::rigid_geometric_algebra::counted;
+  using ::rigid_geometric_algebra::field;
+  using ::rigid_geometric_algebra::field_identity;
+  using ::rigid_geometric_algebra::operation_counts;
+  using ::rigid_geometric_algebra::wedge;
+
+  using C = counted<double>;
+  using G3 = algebra<C, 3>;
+
+  "counted is a field"_test = [] {
+    return expect(
+        field<C> and field<counted<float>> and
+        eq(C{1.}, field_identity<C, std::multiplies<>>));
+  };
+
+  "arithmetic operations are counted"_test = [] {
+    C::reset();
+
+    const auto x = C{3.};
+    const auto y = C{2.};
+    const auto z = -((x + y) * (x - y) / y + x * y);
+
+    return expect(
+        eq(-8.5, z.value()) and
+        eq(operation_counts{
+               .additions = 2,
+               .subtractions = 1,
+               .multiplications = 2,
+               .divisions = 1,
+               .negations = 1},
+           C::counts()) and
+        eq(7UZ, C::counts().total()));
+  };
+
+  "comparisons are not counted"_test = [] {
+    C::reset();
+
+    const auto x = C{3.};
+    const auto y = C{2.};
+    const auto less = y < x;
+
+    return expect(less and x != y and eq(0UZ, C::counts().total()));
+  };
+
+  "reset clears the counters"_test = [] {
+    const auto x = C{1.} + C{1.};
+    C::reset();
+
+    return expect(eq(2., x.value()) and eq(operation_counts{}, C::counts()));
+  };
+
+  "counters are thread-local"_test = [] {
+    C::reset();
+    const auto x = C{1.} + C{1.};
+
+    auto other = operation_counts{};
+    std::jthread{[&other] {
+      const auto y = C{1.} * C{1.};
+      other = C::counts();
+      static_cast<void>(y);
+    }}.join();
+
+    return expect(
+        eq(2., x.value()) and eq(1UZ, C::counts().additions) and
+        eq(0UZ, C::counts().multiplications) and
+        eq(1UZ, other.multiplications) and eq(0UZ, other.additions));
+  };
+
+  "operations of algebra operators are counted"_test = [] {
+    const auto p = G3::point{1., 2., 3., 4.};
+    const auto q = G3::point{1., -1., 0., 2.};
+
+    C::reset();
+    const auto sum = p.multivector() + q.multivector();
+    const auto sum_counts = C::counts();
+
+    C::reset();
+    const auto l = wedge(p.multivector(), q.multivector());
+    const auto wedge_counts = C::counts();
+
+    C::reset();
+    const auto m = G3::line{l};
+    const auto line_counts = C::counts();
+
+    return expect(
+        eq(G3::point{2., 1., 3., 6.}.multivector(), sum) and
+        eq(4UZ, sum_counts.additions) and eq(4UZ, sum_counts.total()) and
+        eq(12UZ, wedge_counts.multiplications) and
+        eq(6UZ, wedge_counts.additions) and eq(0UZ, wedge_counts.divisions) and
+        eq(l, m.multivector()) and eq(0UZ, line_counts.total()));
+  };
+}
@@ -90,4 +90,43 @@ auto main() -> int
   "postcondition with message"_test = [] {
     return expect(aborts([] { postcondition(false, "failure"); }));
   };
+
+  "lazy handler is not invoked if condition holds"_test = [] {
+    auto invoked = false;
+
+    precondition(true, [&invoked] {
+      invoked = true;
+      return contract_violation_handler{""};
+    });
+
+    return expect(not invoked);
+  };
+
+  "precondition with lazy handler"_test = [] {
+    return expect(aborts([] {
+      precondition(false, [x = 42] {
+        return contract_violation_handler{"{}", x};
+      });
+    }));
+  };
+
+  "invariant with lazy logging"_test = [] {
+    auto ss = std::stringstream{};
+
+    ::rigid_geometric_algebra::detail::invariant(false, [&ss, x = 42] {
+      return logging_violation_handler{ss, "value is {}", x};
+    });
+
+    return expect(
+        ss.view().contains("INVARIANT FAILURE") and
+        ss.view().contains("test/detail/contract_test.cpp:116") and
+        ss.view().contains("value is 42"));
+  };
+
+  "lazy handler in constant expressions"_test = [] {
+    return expect([] {
+      precondition(true, [] { return contract_violation_handler{""}; });
+      return true;
+    }());
+  };
 }
@@ -0,0 +1,70 @@
+#include "rigid_geometric_algebra/detail/counted_sort.hpp"
+#include "rigid_geometric_algebra/detail/even.hpp"
+#include "rigid_geometric_algebra/detail/inversion_count.hpp"
+#include "skytest/skytest.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+auto main() -> int
+{
+  using ::rigid_geometric_algebra::detail::counted_sort;
+  using ::rigid_geometric_algebra::detail::even;
+  using ::rigid_geometric_algebra::detail::inversion_count;
+
+  using namespace skytest::literals;
+  using ::skytest::aborts;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  "num inversions"_ctest = [] {
+    return expect(
+        eq(0UZ, inversion_count(std::array<std::size_t, 0>{})) and
+        eq(0UZ, inversion_count(std::array{1UZ})) and
+        eq(0UZ, inversion_count(std::array{1UZ, 2UZ})) and
+        eq(1UZ, inversion_count(std::array{2UZ, 1UZ})) and
+        eq(1UZ, inversion_count(std::array{2UZ, 1UZ, 3UZ})) and
+        eq(2UZ, inversion_count(std::array{2UZ, 3UZ, 1UZ})) and
+        eq(3UZ, inversion_count(std::array{4UZ, 1UZ, 2UZ, 3UZ})) and
+        eq(6UZ, inversion_count(std::array{3UZ, 2UZ, 1UZ, 0UZ})));
+  };
+
+  "inversions of concatenated ranges"_ctest = [] {
+    return expect(
+        eq(0UZ, inversion_count(std::array{0UZ, 1UZ}, std::array{2UZ})) and
+        eq(2UZ, inversion_count(std::array{2UZ}, std::array{0UZ, 1UZ})) and
+        eq(5UZ,
+           inversion_count(
+               std::array{3UZ, 1UZ},
+               std::array<std::size_t, 0>{},
+               std::array{2UZ, 0UZ})));
+  };
+
+  "parity matches counted_sort for all permutations"_ctest = [] {
+    auto values = std::array{0UZ, 1UZ, 2UZ, 3UZ, 4UZ};
+    auto mismatches = 0UZ;
+
+    do {
+      auto sorted = values;
+      const auto expected = even(counted_sort(sorted));
+
+      for (auto n = 0UZ; n <= values.size(); ++n) {
+        const auto split = std::span{values}.first(n);
+        const auto rest = std::span{values}.subspan(n);
+
+        mismatches +=
+            std::size_t(even(inversion_count(split, rest)) != expected);
+      }
+    } while (std::ranges::next_permutation(values).found);
+
+    return expect(eq(0UZ, mismatches));
+  };
+
+  "values must be unique"_test = [] {
+    return aborts([] {
+      static_cast<void>(inversion_count(std::array{1UZ, 2UZ, 1UZ}));
+    });
+  };
+}
@@ -0,0 +1,146 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+  using magnitude = ::rigid_geometric_algebra::homogeneous_magnitude_t<G3>;
+
+  using ::rigid_geometric_algebra::bulk_norm;
+  using ::rigid_geometric_algebra::distance;
+  using ::rigid_geometric_algebra::homogeneous_magnitude;
+  using ::rigid_geometric_algebra::soa_span;
+  using ::rigid_geometric_algebra::weight_norm;
+
+  "homogeneous magnitude contains a scalar and an antiscalar"_test = [] {
+    return expect(
+        magnitude::contains<G3::scalar> and
+        magnitude::contains<G3::antiscalar> and eq(2UZ, magnitude::size));
+  };
+
+  "bulk and weight norms"_test = [] {
+    const auto p = G3::point{2, 3, 0, 4};
+    const auto g = G3::plane{0, 3, 4, -1};
+
+    return expect(
+        eq(5., bulk_norm(p)) and eq(2., weight_norm(p)) and
+        eq(1., bulk_norm(g)) and eq(5., weight_norm(g)));
+  };
+
+  "point to point"_test = [] {
+    // (1, 2, 3) and (4, 6, 3)
+    const auto p = G3::point{1, 1, 2, 3};
+    const auto q = G3::point{2, 8, 12, 6};
+
+    return expect(
+        eq(homogeneous_magnitude<G3>(10, 2), distance(p, q)) and
+        eq(distance(p, q), distance(q, p)));
+  };
+
+  "point to line"_test = [] {
+    // x axis
+    const auto l = G3::line{2, 0, 0, 0, 0, 0};
+    const auto p = G3::point{1, 5, 3, 4};
+
+    return expect(
+        eq(homogeneous_magnitude<G3>(10, 2), distance(p, l)) and
+        eq(distance(p, l), distance(l, p)));
+  };
+
+  "point to plane"_test = [] {
+    // z = 1
+    const auto g = G3::plane{0, 0, 1, -1};
+    const auto p = G3::point{2, 1, 2, 3};
+
+    return expect(
+        eq(homogeneous_magnitude<G3>(1, 2), distance(p, g)) and
+        eq(distance(p, g), distance(g, p)));
+  };
+
+  "line to line"_test = [] {
+    // x axis and the line through (0, 0, 2) in the y direction
+    const auto k = G3::line{1, 0, 0, 0, 0, 0};
+    const auto l = G3::point{1, 0, 0, 2} ^ G3::point{1, 0, 3, 2};
+
+    return expect(eq(homogeneous_magnitude<G3>(6, 3), distance(k, l)));
+  };
+
+  "parallel lines"_test = [] {
+    // x axis, in both directions, and the line through (0, 0, 2) in the x
+    // direction
+    const auto k = G3::line{1, 0, 0, 0, 0, 0};
+    const auto k2 = G3::line{-2, 0, 0, 0, 0, 0};
+    const auto l = G3::point{1, 0, 0, 2} ^ G3::point{1, 1, 0, 2};
+
+    return expect(
+        eq(homogeneous_magnitude<G3>(2, 1), distance(k, l)) and
+        eq(homogeneous_magnitude<G3>(8, 4), distance(k2, l)) and
+        eq(homogeneous_magnitude<G3>(4, 2), distance(l, k2)));
+  };
+
+  "nearly parallel lines"_test = [] {
+    // lines in the direction (0.7, 0.3, 0.1) through (0.1, 0.2, 0.3) and
+    // (0.1, 0.2, 1.3), whose directions differ by rounding error
+    const auto k = G3::point{1, 0.1, 0.2, 0.3} ^
+                   G3::point{1, 0.1 + 0.7, 0.2 + 0.3, 0.3 + 0.1};
+    const auto l = G3::point{1, 0.1, 0.2, 1.3} ^
+                   G3::point{1, 0.1 + 0.7, 0.2 + 0.3, 1.3 + 0.1};
+
+    const auto d = distance(k, l);
+
+    // |(0, 0, 1) x (0.7, 0.3, 0.1)| / |(0.7, 0.3, 0.1)|
+    const auto expected = std::sqrt(0.58 / 0.59);
+
+    return expect(
+        std::abs(d.get<0>().coefficient / d.get<1>().coefficient - expected) <
+        1e-9);
+  };
+
+  "coincident lines"_test = [] {
+    // line through (0, 0, 2) in the x direction, with different weights
+    const auto l = G3::point{1, 0, 0, 2} ^ G3::point{1, 1, 0, 2};
+    const auto l2 = G3::point{1, 0, 0, 2} ^ G3::point{1, 3, 0, 2};
+
+    return expect(
+        eq(homogeneous_magnitude<G3>(0, 1), distance(l, l)) and
+        eq(homogeneous_magnitude<G3>(0, 3), distance(l, l2)));
+  };
+
+  "plane to parallel plane"_test = [] {
+    // z = 1 and z = 5
+    const auto g = G3::plane{0, 0, 2, -2};
+    const auto h = G3::plane{0, 0, -1, 5};
+
+    return expect(eq(homogeneous_magnitude<G3>(8, 2), distance(g, h)));
+  };
+
+  "batched distances to a plane"_test = [] {
+    auto in = std::array<std::vector<double>, G3::point::size>{
+        std::vector{1., 2.},
+        std::vector{0., 1.},
+        std::vector{0., 2.},
+        std::vector{4., 3.}};
+    auto out = std::array<std::vector<double>, magnitude::size>{};
+    for (auto& column : out) {
+      column.resize(2);
+    }
+
+    const auto g = G3::plane{0, 0, 1, -1};
+    const auto ds = soa_span<magnitude>{out};
+
+    distance(soa_span<const G3::point>{in}, g, ds);
+
+    return expect(
+        eq(homogeneous_magnitude<G3>(3, 1), ds[0]) and
+        eq(homogeneous_magnitude<G3>(1, 2), ds[1]));
+  };
+}
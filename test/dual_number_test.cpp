@@ -0,0 +1,120 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include "test/skytest_ext.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::approx_equal;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using ::rigid_geometric_algebra::antiwedge;
+  using ::rigid_geometric_algebra::dual_number;
+  using ::rigid_geometric_algebra::exp;
+  using ::rigid_geometric_algebra::field;
+  using ::rigid_geometric_algebra::field_identity;
+  using ::rigid_geometric_algebra::get;
+  using ::rigid_geometric_algebra::log;
+  using ::rigid_geometric_algebra::transform;
+
+  using D2 = dual_number<double, 2>;
+  using D6 = dual_number<double, 6>;
+  using G3 = ::rigid_geometric_algebra::algebra<D6, 3>;
+
+  "dual number is a field"_test = [] {
+    return expect(
+        field<D2> and eq(D2{1}, field_identity<D2, std::multiplies<>>));
+  };
+
+  "arithmetic propagates derivatives"_ctest = [] {
+    const auto x = D2::variable(3, 0);
+    const auto y = D2::variable(2, 1);
+
+    return expect(
+        eq(D2{5, {1, 1}}, x + y) and eq(D2{1, {1, -1}}, x - y) and
+        eq(D2{6, {2, 3}}, x * y) and eq(D2{1.5, {0.5, -0.75}}, x / y) and
+        eq(D2{-3, {-1, 0}}, -x));
+  };
+
+  "elementary functions propagate derivatives"_test = [] {
+    const auto x = D2::variable(0.5, 0);
+
+    return expect(
+        eq(D2{std::sin(0.5), {std::cos(0.5), 0}}, sin(x)) and
+        eq(D2{std::cos(0.5), {-std::sin(0.5), 0}}, cos(x)) and
+        eq(D2{2, {0.25, 0}}, sqrt(D2::variable(4, 0))) and
+        eq(D2{}, sqrt(D2{})));
+  };
+
+  "atan2 propagates derivatives"_test = [] {
+    const auto y = D2::variable(1, 0);
+    const auto x = D2::variable(1, 1);
+
+    return expect(
+        eq(D2{std::atan2(1., 1.), {0.5, -0.5}}, atan2(y, x)) and
+        eq(D2{}, atan2(D2{}, D2{})));
+  };
+
+  "log is differentiated through exp"_test = [] {
+    constexpr auto values = std::array{0.1, -0.2, 0.3, 0.4, 0.5, -0.6};
+
+    auto b = G3::line::multivector_type{};
+    [&b, &values]<std::size_t... Is>(std::index_sequence<Is...>) {
+      ((b.template get<Is>().coefficient = D6::variable(values[Is], Is)), ...);
+    }(std::make_index_sequence<6>{});
+
+    const auto l = log(exp(b));
+
+    constexpr auto identity = [] {
+      auto e = std::array<std::array<double, 6>, 6>{};
+      for (auto i = 0UZ; i != e.size(); ++i) {
+        e[i][i] = 1.;
+      }
+      return e;
+    }();
+
+    // the derivatives of `log(exp(b))` with respect to `b` are the identity
+    return [&l, &values, &identity]<std::size_t... Is>(
+               std::index_sequence<Is...>) {
+      return expect(
+          approx_equal(
+              values,
+              std::array{l.template get<Is>().coefficient.value...}) and
+          (approx_equal(
+               identity[Is], l.template get<Is>().coefficient.gradient) and
+           ...));
+    }(std::make_index_sequence<6>{});
+  };
+
+  "point to plane residual is differentiated through exp"_test = [] {
+    // derivatives with respect to the line `b` at `b = 0`
+    auto b = G3::line::multivector_type{};
+    [&b]<std::size_t... Is>(std::index_sequence<Is...>) {
+      ((b.template get<Is>().coefficient = D6::variable(0, Is)), ...);
+    }(std::make_index_sequence<6>{});
+
+    const auto q = exp(b);
+
+    // a rotation about z by `2 b[2]` moves (1, 0, 0) toward -y and a
+    // translation by `-2 b[3]` moves it along -x
+    const auto p = transform(q, G3::point{1., 1., 0., 0.}).multivector();
+    const auto gx = G3::plane{1., 0., 0., -2.}.multivector();
+    const auto gy = G3::plane{0., 1., 0., 0.}.multivector();
+
+    const auto rx = get<G3::scalar>(antiwedge(gx, p)).coefficient;
+    const auto ry = get<G3::scalar>(antiwedge(gy, p)).coefficient;
+
+    return expect(
+        eq(-1., rx.value) and
+        approx_equal(std::array{0., 0., 0., -2., 0., 0.}, rx.gradient) and
+        eq(0., ry.value) and
+        approx_equal(std::array{0., 0., -2., 0., -2., 0.}, ry.gradient));
+  };
+}
@@ -0,0 +1,171 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+using ::rigid_geometric_algebra::algebra;
+using ::rigid_geometric_algebra::antiwedge;
+using ::rigid_geometric_algebra::geometric_antiproduct;
+using ::rigid_geometric_algebra::geometric_product;
+using ::rigid_geometric_algebra::wedge;
+using ::rigid_geometric_algebra::detail::type_list;
+
+using G2 = algebra<double, 2>;
+using G3 = algebra<double, 3>;
+using G4 = algebra<double, 4>;
+using dynamic = ::rigid_geometric_algebra::dynamic_multivector<double>;
+
+// every blade of G3, in canonical blade order
+using all_blades = decltype([]<class... B1s, class... B2s, class... B3s>(
+                                type_list<B1s...>,
+                                type_list<B2s...>,
+                                type_list<B3s...>) {
+  return type_list<G3::scalar, B1s..., B2s..., B3s..., G3::antiscalar>{};
+}(G3::point::multivector_type::blade_list_type{},
+  G3::line::multivector_type::blade_list_type{},
+  G3::plane::multivector_type::blade_list_type{}));
+
+template <class B>
+constexpr auto mask_of = static_cast<dynamic::mask_type>(
+    B::dimension_mask.to_unsigned());
+
+// number of blade pairs where the runtime Cayley table of `op` differs from
+// the blade overload of `op`
+auto table_mismatches(const auto& op) -> std::size_t
+{
+  return []<class... Bs>(const auto& op, type_list<Bs...>) {
+    auto mismatches = 0UZ;
+
+    const auto compare = [&op, &mismatches]<class B1, class B2>(B1, B2) {
+      const auto expected = op(B1{2.}, B2{3.});
+      const auto actual =
+          op(dynamic{4, {{mask_of<B1>, 2.}}}, dynamic{4, {{mask_of<B2>, 3.}}});
+
+      if constexpr (requires { expected.coefficient; }) {
+        using R = std::remove_cvref_t<decltype(expected)>;
+        mismatches += std::size_t(
+            actual != dynamic{4, {{mask_of<R>, expected.coefficient}}});
+      } else {
+        mismatches += std::size_t(actual.size() != 0);
+      }
+    };
+
+    const auto row = [&compare]<class B1>(B1) { (compare(B1{}, Bs{}), ...); };
+    (row(Bs{}), ...);
+
+    return mismatches;
+  }(op, all_blades{});
+}
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::aborts;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  "terms are stored in canonical blade order"_test = [] {
+    // e0 + e1 + e23 + e1 + e31 + 1
+    const auto x = dynamic{
+        4,
+        {{0b0001, 1.},
+         {0b0010, 2.},
+         {0b1100, 3.},
+         {0b0010, 4.},
+         {0b1010, 5.},
+         {0b0000, 6.}}};
+
+    using term = dynamic::term;
+
+    return expect(
+        eq(4UZ, x.dimension()) and eq(5UZ, x.size()) and
+        eq(term{0b0000, 6.}, x.terms()[0]) and
+        eq(term{0b0001, 1.}, x.terms()[1]) and
+        eq(term{0b0010, 6.}, x.terms()[2]) and
+        eq(term{0b1100, 3.}, x.terms()[3]) and
+        eq(term{0b1010, 5.}, x.terms()[4]) and
+        eq(6., x.coefficient(0b0010)) and eq(0., x.coefficient(0b0100)));
+  };
+
+  "converts from and to multivector"_test = [] {
+    const auto p = G3::point{1, 2, 3, 4};
+    const auto x = dynamic{p};
+
+    return expect(
+        eq(4UZ, x.size()) and eq(2., x.coefficient(0b0010)) and
+        eq(p.multivector(),
+           static_cast<G3::point::multivector_type>(x)) and
+        eq(G3::motor::multivector_type{},
+           static_cast<G3::motor::multivector_type>(dynamic{4})));
+  };
+
+  "conversion requires blades of the target type"_test = [] {
+    return aborts([] {
+      static_cast<void>(
+          static_cast<G3::point::multivector_type>(dynamic{G3::line{}}));
+    });
+  };
+
+  "vector space operations"_test = [] {
+    const auto x = dynamic{4, {{0b0010, 1.}, {0b0100, 2.}}};
+    const auto y = dynamic{4, {{0b0100, 3.}, {0b1000, 4.}}};
+
+    return expect(
+        eq(dynamic{4, {{0b0010, 1.}, {0b0100, 5.}, {0b1000, 4.}}}, x + y) and
+        eq(dynamic{4, {{0b0010, 1.}, {0b0100, -1.}, {0b1000, -4.}}}, x - y) and
+        eq(dynamic{4, {{0b0010, -1.}, {0b0100, -2.}}}, -x) and
+        eq(dynamic{4, {{0b0010, 2.}, {0b0100, 4.}}}, 2. * x));
+  };
+
+  "operands must have the same dimension"_test = [] {
+    return aborts([] { static_cast<void>(wedge(dynamic{3}, dynamic{4})); });
+  };
+
+  "cayley tables match blade products"_test = [] {
+    return expect(
+        eq(0UZ, table_mismatches(geometric_product)) and
+        eq(0UZ, table_mismatches(geometric_antiproduct)) and
+        eq(0UZ, table_mismatches(wedge)) and
+        eq(0UZ, table_mismatches(antiwedge)));
+  };
+
+  "products match multivector products"_test = [] {
+    const auto p = G3::point{1, 2, 3, 4};
+    const auto q = G3::point{1, -1, 0, 2};
+    const auto g = G3::plane{1, 2, -2, 1};
+    const auto h = G3::plane{0, 1, 1, -3};
+    const auto m = G3::motor{1, 2, 3, 4, 5, 6, 7, 8};
+    const auto n = G3::motor{-1, 0, 2, 1, 3, -2, 1, 1};
+
+    return expect(
+        eq(wedge(p.multivector(), q.multivector()),
+           static_cast<G3::line::multivector_type>(
+               wedge(dynamic{p}, dynamic{q}))) and
+        eq(antiwedge(g.multivector(), h.multivector()),
+           static_cast<G3::line::multivector_type>(
+               antiwedge(dynamic{g}, dynamic{h}))) and
+        eq(geometric_antiproduct(m.multivector(), n.multivector()),
+           static_cast<G3::motor::multivector_type>(
+               geometric_antiproduct(dynamic{m}, dynamic{n}))));
+  };
+
+  "dimension is selected at run time"_test = [] {
+    const auto check = []<class A>(std::type_identity<A>) {
+      auto p = typename A::point::multivector_type{};
+      auto q = p;
+      p.template get<0>().coefficient = 1.;
+      p.template get<1>().coefficient = 2.;
+      q.template get<0>().coefficient = 1.;
+      q.template get<2>().coefficient = 3.;
+
+      using V = decltype(wedge(p, q));
+      return static_cast<V>(wedge(dynamic{p}, dynamic{q})) == wedge(p, q);
+    };
+
+    return expect(
+        check(std::type_identity<G2>{}) and
+        check(std::type_identity<G3>{}) and
+        check(std::type_identity<G4>{}));
+  };
+}
@@ -0,0 +1,112 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include "test/skytest_ext.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using bivector = G3::line::multivector_type;
+
+// power series of the geometric antiproduct, truncated after 30 terms
+static constexpr auto exp_series = [](const bivector& l) {
+  using ::rigid_geometric_algebra::geometric_antiproduct;
+  using ::rigid_geometric_algebra::to_multivector;
+  using M = G3::motor::multivector_type;
+
+  auto term = M{to_multivector(G3::unit_hypervolume)};
+  auto sum = term;
+
+  for (auto k = 1; k != 30; ++k) {
+    term = (1. / k) * M{geometric_antiproduct(term, l)};
+    sum = sum + term;
+  }
+
+  return sum;
+};
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::approx_equal;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using ::rigid_geometric_algebra::antireverse;
+  using ::rigid_geometric_algebra::exp;
+  using ::rigid_geometric_algebra::geometric_antiproduct;
+  using ::rigid_geometric_algebra::get;
+  using ::rigid_geometric_algebra::soa_span;
+
+  "exp of a line is a motor"_test = [] {
+    return expect(
+        std::is_same_v<G3::motor, decltype(exp(G3::line{}))> and
+        std::is_same_v<G3::motor, decltype(exp(bivector{}))>);
+  };
+
+  "exp of zero is the identity"_test = [] {
+    return expect(eq(G3::motor::identity(), exp(G3::line{})));
+  };
+
+  "closed form matches power series"_test * std::tuple{
+      bivector{0.3, -0.2, 0.5, 0.7, 0.1, -0.4},
+      bivector{1.3, -0.9, 1.5, 0.7, 0.1, -0.4},
+      bivector{0, 0, 2.5, 0, -1, 0},
+      bivector{1e-4, 2e-4, -1e-4, 0.3, 0.2, 0.1},
+      bivector{1e-9, 0, 0, 1, 2, 3},
+      bivector{0, 0, 0, 1, 2, 3}} = [](const auto& l) {
+    return expect(approx_equal(exp_series(l), exp(l).multivector()));
+  };
+
+  "exp of a line at infinity is a translator"_test = [] {
+    return expect(
+        eq(G3::motor{0, 0, 0, 0, -0.5, -1, 0, 1},
+           exp(G3::line{0, 0, 0, -0.5, -1, 0})));
+  };
+
+  "exp of a line through the origin rotates about the line"_test = [] {
+    static constexpr auto phi = 0.3;
+
+    const auto q = exp(G3::line{0, 0, phi / 2, 0, 0, 0}).multivector();
+    const auto p = G3::point{1, 1, 0, 0}.multivector();
+
+    const auto r = geometric_antiproduct(
+        geometric_antiproduct(q, p), antireverse(q));
+
+    return expect(approx_equal(
+        G3::point{1, std::cos(phi), -std::sin(phi), 0}.multivector(),
+        G3::point{
+            get<G3::blade<0>>(r).coefficient,
+            get<G3::blade<1>>(r).coefficient,
+            get<G3::blade<2>>(r).coefficient,
+            get<G3::blade<3>>(r).coefficient}
+            .multivector()));
+  };
+
+  "batched exp matches exp"_test = [] {
+    const auto lines = std::array{
+        bivector{0.3, -0.2, 0.5, 0.7, 0.1, -0.4},
+        bivector{1e-4, 2e-4, -1e-4, 0.3, 0.2, 0.1},
+        bivector{0, 0, 0, 1, 2, 3}};
+
+    auto in = std::array<std::array<double, lines.size()>, bivector::size>{};
+    auto out =
+        std::array<std::array<double, lines.size()>, G3::motor::size>{};
+
+    const auto ls = soa_span<bivector>{in};
+    for (auto i = 0UZ; i != lines.size(); ++i) {
+      ls.store(i, lines[i]);
+    }
+
+    const auto qs = soa_span<G3::motor>{out};
+    exp(soa_span<const bivector>{ls}, qs);
+
+    return expect(
+        eq(exp(lines[0]), qs[0]) and eq(exp(lines[1]), qs[1]) and
+        eq(exp(lines[2]), qs[2]));
+  };
+}
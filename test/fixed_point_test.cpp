@@ -0,0 +1,144 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include "test/skytest_ext.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numbers>
+
+using ::rigid_geometric_algebra::fixed_point;
+using ::rigid_geometric_algebra::overflow_policy;
+
+using Q = fixed_point<32>;
+using W = fixed_point<32, overflow_policy::wrap>;
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using GQ = ::rigid_geometric_algebra::algebra<Q, 3>;
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::approx_equal;
+  using ::skytest::eq;
+  using ::skytest::expect;
+  using ::skytest::lt;
+
+  using ::rigid_geometric_algebra::antiwedge;
+  using ::rigid_geometric_algebra::exp;
+  using ::rigid_geometric_algebra::field;
+  using ::rigid_geometric_algebra::field_identity;
+  using ::rigid_geometric_algebra::log;
+  using ::rigid_geometric_algebra::transform;
+  using ::rigid_geometric_algebra::wedge;
+
+  using limits = std::numeric_limits<std::int64_t>;
+
+  "fixed_point is a field"_test = [] {
+    return expect(
+        field<Q> and field<W> and field<fixed_point<16>> and
+        eq(Q{1}, field_identity<Q, std::multiplies<>>));
+  };
+
+  "exact operations"_ctest = [] {
+    const auto x = Q{3};
+    const auto half = Q{1} / Q{2};
+
+    return expect(
+        eq(Q::from_raw(std::int64_t{1} << 31), half) and
+        eq(Q{7} / Q{2}, x + half) and eq(Q{5} / Q{2}, x - half) and
+        eq(Q{3} / Q{2}, x * half) and eq(Q{6}, x / half) and eq(Q{-3}, -x));
+  };
+
+  "products are rounded to nearest with ties rounded up"_ctest = [] {
+    const auto half = Q{1} / Q{2};
+
+    return expect(
+        eq(Q::from_raw(2), Q::from_raw(3) * half) and
+        eq(Q::from_raw(-1), Q::from_raw(-3) * half) and
+        eq(Q::from_raw(1), Q::from_raw(1) * half));
+  };
+
+  "saturating overflow"_ctest = [] {
+    const auto max = Q::from_raw(limits::max());
+    const auto min = Q::from_raw(limits::min());
+    const auto big = Q{1 << 20};
+
+    return expect(
+        eq(max, max + Q::from_raw(1)) and eq(min, min - Q::from_raw(1)) and
+        eq(max, -min) and eq(max, big * big) and eq(min, -big * big) and
+        eq(max, Q{limits::max()}));
+  };
+
+  "wrapping overflow"_ctest = [] {
+    const auto max = W::from_raw(limits::max());
+    const auto min = W::from_raw(limits::min());
+    const auto big = W{1 << 20};
+
+    return expect(
+        eq(min, max + W::from_raw(1)) and eq(max, min - W::from_raw(1)) and
+        eq(min, -min) and eq(W{}, big * big));
+  };
+
+  "conversion to and from floating-point"_test = [] {
+    return expect(
+        eq(0.25, static_cast<double>(Q{0.25})) and
+        eq(-1.5F, static_cast<float>(Q{-1.5})) and
+        eq(Q::from_raw(limits::max()), Q{1e30}) and
+        eq(Q::from_raw(1), Q{0x1p-33 + 0x1p-40}));
+  };
+
+  "elementary functions"_test = [] {
+    constexpr auto tolerance = 1e-8;
+    const auto error = [](Q x, double expected) {
+      return std::abs(static_cast<double>(x) - expected);
+    };
+
+    return expect(
+        eq(Q{3}, sqrt(Q{9})) and eq(Q{2}, abs(Q{-2})) and
+        lt(error(sqrt(Q{2}), std::numbers::sqrt2), tolerance) and
+        lt(error(Q::pi(), std::numbers::pi), tolerance) and
+        lt(error(sin(Q{1}), std::sin(1.)), tolerance) and
+        lt(error(cos(Q{1}), std::cos(1.)), tolerance) and
+        lt(error(sin(Q{-10}), std::sin(-10.)), tolerance) and
+        lt(error(cos(Q{10}), std::cos(10.)), tolerance) and
+        lt(error(atan2(Q{1}, Q{2}), std::atan2(1., 2.)), tolerance) and
+        lt(error(atan2(Q{2}, Q{-1}), std::atan2(2., -1.)), tolerance) and
+        lt(error(atan2(Q{-3}, Q{-1}), std::atan2(-3., -1.)), tolerance) and
+        eq(Q{}, atan2(Q{}, Q{})));
+  };
+
+  "wedge and antiwedge are exact for integer coordinates"_ctest = [] {
+    const auto p = GQ::point{1, 2, 3, 4};
+    const auto q = GQ::point{1, -1, 0, 2};
+    const auto r = GQ::point{1, 0, 5, -3};
+
+    const auto g =
+        wedge(wedge(p.multivector(), q.multivector()), r.multivector());
+    const auto h = GQ::plane{0, 0, 1, -1}.multivector();
+
+    return expect(
+        eq(GQ::plane{25, -17, -12, 49}.multivector(), g) and
+        eq(GQ::line::multivector_type{-17, -25, 0, 25, -17, 37},
+           antiwedge(g, h)));
+  };
+
+  "exp, log, and transform"_test = [] {
+    const auto b = G3::line::multivector_type{0.1, -0.2, 0.3, 0.4, 0.5, -0.6};
+    const auto bq = GQ::line::multivector_type{
+        Q{0.1}, Q{-0.2}, Q{0.3}, Q{0.4}, Q{0.5}, Q{-0.6}};
+
+    const auto p = G3::point{1., 2., -1., 3.};
+    const auto pq = GQ::point{1, 2, -1, 3};
+
+    return expect(
+        approx_equal(exp(bq).multivector(), exp(b).multivector(), 1e-8) and
+        approx_equal(log(exp(bq)), b, 1e-8) and
+        approx_equal(
+            transform(exp(bq), pq).multivector(),
+            transform(exp(b), p).multivector(),
+            1e-8));
+  };
+}
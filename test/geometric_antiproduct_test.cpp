@@ -0,0 +1,83 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include <symengine/compat.hpp>
+#include <type_traits>
+
+using ::rigid_geometric_algebra::geometric_antiproduct;
+using ::rigid_geometric_algebra::geometric_product;
+using ::rigid_geometric_algebra::left_complement;
+using ::rigid_geometric_algebra::right_complement;
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+  using GS3 = ::rigid_geometric_algebra::algebra<::SymEngine::Expression, 3>;
+
+  "geometric antiproduct property"_ctest = [] {
+    const auto a = G3::blade<1>{3};
+    const auto b = G3::blade<0, 2>{4};
+    const auto c = G3::blade<3, 1>{2};
+    const auto d = G3::blade<0, 2, 3>{5};
+
+    return expect(
+        eq(left_complement(
+               geometric_product(right_complement(a), right_complement(b))),
+           geometric_antiproduct(a, b)) and
+        eq(left_complement(
+               geometric_product(right_complement(c), right_complement(d))),
+           geometric_antiproduct(c, d)) and
+        eq(right_complement(
+               geometric_product(left_complement(d), left_complement(a))),
+           geometric_antiproduct(d, a)));
+  };
+
+  "unit hypervolume is the identity"_ctest = [] {
+    const auto x = G3::blade<0, 1>{2} + G3::blade<2, 3>{3} + G3::blade<>{4} +
+                   G3::blade<0>{5};
+    const auto& id = G3::unit_hypervolume;
+
+    return expect(
+        eq(x, geometric_antiproduct(id, x)) and
+        eq(x, geometric_antiproduct(x, id)));
+  };
+
+  "geometric antiproduct of blades"_ctest = [] {
+    return expect(
+        eq(G3::blade<0, 1, 2, 3>{-6},
+           geometric_antiproduct(G3::blade<0, 1>{2}, G3::blade<0, 1>{3})) and
+        eq(G3::blade<0, 3>{-1},
+           geometric_antiproduct(G3::blade<0, 1>{1}, G3::blade<0, 2>{1})) and
+        eq(G3::blade<>{-1},
+           geometric_antiproduct(G3::blade<1>{1}, G3::blade<0, 2, 3>{1})));
+  };
+
+  "bulk antisquares to zero"_ctest = [] {
+    return expect(
+        eq(G3::zero,
+           geometric_antiproduct(G3::blade<2, 3>{1}, G3::blade<3, 1>{1})));
+  };
+
+  "geometric antiproduct of lines is a motor"_test = [] {
+    const auto l = G3::line{1, 0, 0, 0, 0, 0};
+    const auto k = G3::line{0, 1, 0, 0, 0, 0};
+
+    return expect(
+        std::is_same_v<G3::motor, decltype(geometric_antiproduct(l, k))> and
+        eq(G3::motor{0, 0, 0, -1, 0, 0, 0, 0}, geometric_antiproduct(l, k)));
+  };
+
+  "geometric antiproduct is associative (symengine)"_test = [] {
+    const auto a = GS3::blade<0, 1>{"a"};
+    const auto b = GS3::blade<0, 2, 3>{"b"};
+    const auto c = GS3::blade<3>{"c"};
+
+    return expect(
+        eq(geometric_antiproduct(geometric_antiproduct(a, b), c),
+           geometric_antiproduct(a, geometric_antiproduct(b, c))));
+  };
+}
@@ -0,0 +1,78 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+using ::rigid_geometric_algebra::geometric_product;
+using ::rigid_geometric_algebra::wedge;
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+  "geometric product of unique factors is the wedge product"_ctest = [] {
+    const auto a = G3::blade<1>{2};
+    const auto b = G3::blade<2, 3>{3};
+    const auto c = G3::blade<0, 3>{5};
+
+    return expect(
+        eq(wedge(a, b), geometric_product(a, b)) and
+        eq(wedge(b, a), geometric_product(b, a)) and
+        eq(wedge(a, c), geometric_product(a, c)) and
+        eq(wedge(c, a), geometric_product(c, a)));
+  };
+
+  "geometric product returns canonical blade"_ctest = [] {
+    return expect(
+        eq(G3::blade<3, 1>{6},
+           geometric_product(G3::blade<3>{2}, G3::blade<1>{3})) and
+        eq(G3::blade<1, 2>{-6},
+           geometric_product(G3::blade<2>{2}, G3::blade<1>{3})));
+  };
+
+  "repeated factors contract"_ctest = [] {
+    return expect(
+        eq(G3::blade<>{6},
+           geometric_product(G3::blade<1>{2}, G3::blade<1>{3})) and
+        eq(G3::blade<>{-1},
+           geometric_product(G3::blade<1, 2>{1}, G3::blade<1, 2>{1})) and
+        eq(G3::blade<0>{1},
+           geometric_product(G3::blade<0, 1>{1}, G3::blade<1>{1})) and
+        eq(G3::blade<0>{-1},
+           geometric_product(G3::blade<1>{1}, G3::blade<0, 1>{1})) and
+        eq(G3::blade<2, 3>{-1},
+           geometric_product(G3::blade<3, 1>{1}, G3::blade<1, 2>{1})) and
+        eq(G3::blade<3, 2, 1>{-1},
+           geometric_product(G3::blade<2, 3>{1}, G3::blade<1>{1})));
+  };
+
+  "projective dimension squares to zero"_ctest = [] {
+    return expect(
+        eq(G3::zero, geometric_product(G3::blade<0>{1}, G3::blade<0>{1})) and
+        eq(G3::zero,
+           geometric_product(G3::blade<0, 1>{1}, G3::blade<0, 2>{1})));
+  };
+
+  "geometric product of zero constant"_ctest = [] {
+    return expect(eq(G3::zero, geometric_product(G3::zero, G3::zero)));
+  };
+
+  "geometric product is associative"_ctest = [] {
+    const auto a = G3::blade<1>{1} + G3::blade<2>{2} + G3::blade<0>{3};
+    const auto b = G3::blade<2, 3>{4} + G3::blade<0, 1>{5} + G3::blade<>{6};
+    const auto c = G3::blade<3>{7} + G3::blade<0, 1, 2>{8};
+
+    return expect(
+        eq(geometric_product(geometric_product(a, b), c),
+           geometric_product(a, geometric_product(b, c))));
+  };
+
+  "geometric product of vectors is inner plus wedge product"_ctest = [] {
+    const auto a = G3::blade<1>{1} + G3::blade<2>{2} + G3::blade<3>{3};
+    const auto b = G3::blade<1>{4} + G3::blade<2>{5} + G3::blade<3>{6};
+
+    return expect(eq(G3::blade<>{32} + wedge(a, b), geometric_product(a, b)));
+  };
+}
@@ -0,0 +1,165 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+#include "support/soa_columns.hpp"
+
+#include "test/skytest_ext.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using bivector = G3::line::multivector_type;
+using body_type = ::rigid_geometric_algebra::rigid_body<G3>;
+using inertia_type = ::rigid_geometric_algebra::rigid_body_inertia<G3>;
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::approx_equal;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using ::rigid_geometric_algebra::antireverse;
+  using ::rigid_geometric_algebra::geometric_antiproduct;
+  using ::rigid_geometric_algebra::get;
+  using ::rigid_geometric_algebra::integrate;
+  using ::rigid_geometric_algebra::soa_span;
+  using ::support::columns;
+
+  static constexpr auto sandwich = [](const G3::motor& q, const auto& x) {
+    return geometric_antiproduct(
+        geometric_antiproduct(q.multivector(), x),
+        antireverse(q.multivector()));
+  };
+
+  static constexpr auto world_momentum = [](const body_type& body,
+                                            const inertia_type& inertia) {
+    const auto l = sandwich(body.pose, inertia.momentum(body.velocity));
+
+    return [&l]<class... Bs>(
+               ::rigid_geometric_algebra::detail::type_list<Bs...>) {
+      return bivector{get<Bs>(l)...};
+    }(bivector::blade_list_type{});
+  };
+
+  "body at rest without forque remains at rest"_test = [] {
+    const auto body = body_type{};
+
+    return expect(eq(body, integrate(body, bivector{}, inertia_type{}, 0.1)));
+  };
+
+  "linear velocity translates the body"_test = [] {
+    const auto body = body_type{.velocity = bivector{0, 0, 0, -1, -2, 0}};
+    const auto next = integrate(body, bivector{}, inertia_type{}, 0.5);
+
+    const auto p = sandwich(next.pose, G3::point{1, 0, 0, 0}.multivector());
+
+    return expect(
+        eq(body.velocity, next.velocity) and
+        approx_equal(G3::point{1, 0.5, 1, 0}.multivector(), p, 1e-15));
+  };
+
+  "angular velocity rotates the body"_test = [] {
+    // angular velocity of 1 about z
+    const auto body = body_type{.velocity = bivector{0, 0, -1, 0, 0, 0}};
+    const auto dt = 0.1;
+    const auto next = integrate(body, bivector{}, inertia_type{}, dt);
+
+    const auto p = sandwich(next.pose, G3::point{1, 1, 0, 0}.multivector());
+
+    return expect(approx_equal(
+        G3::point{1, std::cos(dt), std::sin(dt), 0}.multivector(), p, 1e-15));
+  };
+
+  "force accelerates the body"_test = [] {
+    const auto inertia = inertia_type{.mass = 2};
+    const auto forque = bivector{4, 0, 0, 0, 0, 0};
+    const auto next = integrate(body_type{}, forque, inertia, 0.5);
+
+    return expect(
+        approx_equal(bivector{0, 0, 0, -1, 0, 0}, next.velocity, 1e-15));
+  };
+
+  "torque accelerates the body"_test = [] {
+    const auto inertia = inertia_type{.moment_x = 1, .moment_y = 4};
+    const auto forque = bivector{0, 0, 0, 0, 2, 0};
+    const auto next = integrate(body_type{}, forque, inertia, 0.5);
+
+    return expect(
+        approx_equal(bivector{0, -0.25, 0, 0, 0, 0}, next.velocity, 1e-15));
+  };
+
+  "rotation about a principal axis is steady"_test = [] {
+    const auto inertia =
+        inertia_type{.mass = 3, .moment_x = 1, .moment_y = 2, .moment_z = 3};
+    auto body = body_type{.velocity = bivector{0, -2, 0, 0, 0, 0}};
+
+    for (auto i = 0; i != 100; ++i) {
+      body = integrate(body, bivector{}, inertia, 0.01);
+    }
+
+    return expect(
+        approx_equal(bivector{0, -2, 0, 0, 0, 0}, body.velocity, 1e-15));
+  };
+
+  "free body approximately conserves world momentum"_test = [] {
+    const auto inertia =
+        inertia_type{.mass = 2, .moment_x = 1, .moment_y = 2, .moment_z = 3};
+    auto body =
+        body_type{.velocity = bivector{-0.1, -1, -0.05, -0.3, 0.2, 0.1}};
+
+    const auto initial = world_momentum(body, inertia);
+    for (auto i = 0; i != 1000; ++i) {
+      body = integrate(body, bivector{}, inertia, 0.001);
+    }
+
+    return expect(
+        approx_equal(initial, world_momentum(body, inertia), 2e-3) and
+        std::abs(
+            get<G3::blade<0, 1, 2, 3>>(geometric_antiproduct(
+                body.pose.multivector(), antireverse(body.pose.multivector())))
+                .coefficient -
+            1) < 1e-12);
+  };
+
+  "batched integration matches single bodies"_test = [] {
+    constexpr auto n = 10UZ;
+
+    auto bodies = std::vector<body_type>(n);
+    auto forques = std::vector<bivector>(n);
+    auto inertias = std::vector<inertia_type>(n);
+
+    for (auto i = 0UZ; i != n; ++i) {
+      const auto x = 0.1 * static_cast<double>(i);
+      bodies[i].velocity = bivector{x, -x, 0.5, 1, x, -1};
+      forques[i] = bivector{1, 0, x, 0, -x, 2};
+      inertias[i] = {.mass = 1 + x, .moment_x = 1, .moment_y = 2 + x};
+    }
+
+    auto pose_columns = columns<G3::motor>(n);
+    auto velocity_columns = columns<bivector>(n);
+    auto forque_columns = columns<bivector>(n);
+
+    const auto qs = soa_span<G3::motor>{pose_columns};
+    const auto bs = soa_span<bivector>{velocity_columns};
+    const auto fs = soa_span<bivector>{forque_columns};
+
+    for (auto i = 0UZ; i != n; ++i) {
+      qs.store(i, bodies[i].pose);
+      bs.store(i, bodies[i].velocity);
+      fs.store(i, forques[i]);
+    }
+
+    integrate(qs, bs, fs, inertias, 0.1, 3);
+
+    auto result = expect(true);
+    for (auto i = 0UZ; i != n; ++i) {
+      const auto expected = integrate(bodies[i], forques[i], inertias[i], 0.1);
+      result = result and eq(expected.pose, qs[i]) and
+               eq(expected.velocity, bs[i]);
+    }
+    return result;
+  };
+}
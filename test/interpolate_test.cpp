@@ -0,0 +1,122 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+#include "support/soa_columns.hpp"
+
+#include "test/skytest_ext.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <numbers>
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using bivector = G3::line::multivector_type;
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::aborts;
+  using ::skytest::approx_equal;
+  using ::skytest::expect;
+
+  using ::rigid_geometric_algebra::exp;
+  using ::rigid_geometric_algebra::interpolate;
+  using ::rigid_geometric_algebra::soa_span;
+  using ::support::columns;
+
+  // rotation by `-2 a` about z and translation by `-2 m`
+  static constexpr auto screw = [](double a, double mx, double my) {
+    return exp(bivector{0, 0, a, mx, my, 0});
+  };
+
+  "endpoints are the interpolated motors"_test = [] {
+    const auto m0 = screw(0.3, 1, 0);
+    const auto m1 = screw(-0.2, 0.5, 2);
+
+    return expect(
+        approx_equal(
+            m0.multivector(), interpolate(m0, m1, 0.).multivector()) and
+        approx_equal(
+            m1.multivector(), interpolate(m0, m1, 1.).multivector()));
+  };
+
+  "midpoint of a rotation halves the angle"_test = [] {
+    const auto m0 = G3::motor::identity();
+    const auto m1 = screw(std::numbers::pi / 4, 0, 0);
+
+    return expect(approx_equal(
+        screw(std::numbers::pi / 8, 0, 0).multivector(),
+        interpolate(m0, m1, 0.5).multivector()));
+  };
+
+  "midpoint of a translation halves the distance"_test = [] {
+    const auto m0 = screw(0, 1, 0);
+    const auto m1 = screw(0, 3, -2);
+
+    return expect(approx_equal(
+        screw(0, 2, -1).multivector(),
+        interpolate(m0, m1, 0.5).multivector()));
+  };
+
+  "interpolation follows the shorter path"_test = [] {
+    const auto m0 = G3::motor::identity();
+    const auto m1 = screw(std::numbers::pi / 4, 0, 0);
+    const auto negated = G3::motor{-1. * m1.multivector()};
+
+    return expect(approx_equal(
+        interpolate(m0, m1, 0.25).multivector(),
+        interpolate(m0, negated, 0.25).multivector()));
+  };
+
+  "resampling matches pairwise interpolation"_test = [] {
+    const auto keys = std::array{
+        screw(0, 0, 0), screw(0.4, 1, 0), screw(0.1, 1, 2), screw(-0.3, 0, 1)};
+
+    auto key_columns = columns<G3::motor>(keys.size());
+    const auto ks = soa_span<G3::motor>{key_columns};
+    for (auto i = 0UZ; i != keys.size(); ++i) {
+      ks.store(i, keys[i]);
+    }
+
+    auto sample_columns = columns<G3::motor>(7);
+    const auto ss = soa_span<G3::motor>{sample_columns};
+
+    interpolate(soa_span<const G3::motor>{ks}, ss);
+
+    // samples at 0, 0.5, 1, ..., 3 key intervals
+    auto result = expect(true);
+    for (auto j = 0UZ; j != ss.size(); ++j) {
+      const auto s = std::min(j / 2, keys.size() - 2);
+      const auto t = 0.5 * static_cast<double>(j) - static_cast<double>(s);
+      result = result and
+               approx_equal(
+                   interpolate(keys[s], keys[s + 1], t).multivector(),
+                   ss[j].multivector());
+    }
+    return result;
+  };
+
+  "resampling a single key repeats it"_test = [] {
+    auto key_columns = columns<G3::motor>(1);
+    const auto ks = soa_span<G3::motor>{key_columns};
+    ks.store(0, screw(0.4, 1, 0));
+
+    auto sample_columns = columns<G3::motor>(3);
+    const auto ss = soa_span<G3::motor>{sample_columns};
+
+    interpolate(soa_span<const G3::motor>{ks}, ss);
+
+    return expect(
+        approx_equal(ks[0].multivector(), ss[0].multivector()) and
+        approx_equal(ks[0].multivector(), ss[2].multivector()));
+  };
+
+  "resampling an empty track aborts"_test = [] {
+    return aborts([] {
+      auto sample_columns = columns<G3::motor>(3);
+      interpolate(
+          soa_span<const G3::motor>{},
+          soa_span<G3::motor>{sample_columns});
+    });
+  };
+}
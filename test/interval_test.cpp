@@ -0,0 +1,78 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include <format>
+#include <functional>
+#include <limits>
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::aborts;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using ::rigid_geometric_algebra::field;
+  using ::rigid_geometric_algebra::field_identity;
+  using ::rigid_geometric_algebra::interval;
+
+  using I = interval<double>;
+
+  "interval is a field"_test = [] {
+    return expect(
+        field<I> and field<interval<float>> and
+        eq(I{1}, field_identity<I, std::multiplies<>>));
+  };
+
+  "exact operations result in a single value"_test = [] {
+    const auto x = I{3};
+    const auto y = I{0.5};
+
+    return expect(
+        eq(I{3.5}, x + y) and eq(I{2.5}, x - y) and eq(I{1.5}, x * y) and
+        eq(I{6}, x / y) and eq(I{-3}, -x));
+  };
+
+  "inexact operations enclose the exact result"_test = [] {
+    const auto third = I{1} / I{3};
+    const auto sum = I{0.1} + I{0.2};
+
+    return expect(
+        third.lower() < third.upper() and third.lower() * 3 <= 1. and
+        1. <= third.upper() * 3 and sum.lower() < sum.upper() and
+        sum.contains(0.1 + 0.2));
+  };
+
+  "products of intervals"_test = [] {
+    return expect(
+        eq(I{-8, 12}, I{-2, 3} * I{-2, 4}) and
+        eq(I{-12, -2}, I{1, 3} * I{-4, -2}));
+  };
+
+  "division by an interval containing zero"_test = [] {
+    constexpr auto inf = std::numeric_limits<double>::infinity();
+    return expect(eq(I{-inf, inf}, I{1} / I{-1, 1}));
+  };
+
+  "overflow is enclosed"_test = [] {
+    constexpr auto max = std::numeric_limits<double>::max();
+    const auto x = I{max} + I{max};
+
+    return expect(eq(max, x.lower()) and eq(x.upper(), x.upper() * 2));
+  };
+
+  "underflow is enclosed"_test = [] {
+    constexpr auto min = std::numeric_limits<double>::min();
+    const auto x = I{min} * I{min};
+
+    return expect(x.lower() <= 0. and 0. < x.upper());
+  };
+
+  "bounds are formatted"_test = [] {
+    return expect(eq(std::string{"[1, 2]"}, std::format("{}", I{1, 2})));
+  };
+
+  "lower bound may not exceed upper bound"_test = [] {
+    return aborts([] { static_cast<void>(I{2, 1}); });
+  };
+}
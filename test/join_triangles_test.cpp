@@ -0,0 +1,121 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+#include "support/soa_columns.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using ::rigid_geometric_algebra::join_triangles;
+using ::rigid_geometric_algebra::soa_span;
+using ::rigid_geometric_algebra::wedge;
+using ::support::columns;
+
+// vertices of a unit cube, scaled by the weight
+const auto cube = std::array{
+    G3::point{1, 0, 0, 0},
+    G3::point{1, 1, 0, 0},
+    G3::point{1, 1, 1, 0},
+    G3::point{1, 0, 1, 0},
+    G3::point{2, 0, 0, 2},
+    G3::point{2, 2, 0, 2},
+    G3::point{2, 2, 2, 2},
+    G3::point{2, 0, 2, 2}};
+
+// two triangles for each face of the cube
+constexpr auto cube_indices = std::array<std::uint32_t, 36>{
+    0, 2, 1, 0, 3, 2, 4, 5, 6, 4, 6, 7, 0, 1, 5, 0, 5, 4,
+    1, 2, 6, 1, 6, 5, 2, 3, 7, 2, 7, 6, 3, 0, 4, 3, 4, 7};
+
+}  // namespace
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::aborts;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  "planes match wedge of triangle vertices"_test = [] {
+    constexpr auto n = cube_indices.size() / 3;
+
+    auto vertex_columns = columns<G3::point>(cube.size());
+    auto plane_columns = columns<G3::plane>(n);
+
+    const auto vertices = soa_span<G3::point>{vertex_columns};
+    const auto planes = soa_span<G3::plane>{plane_columns};
+
+    for (auto i = 0UZ; i != cube.size(); ++i) {
+      vertices.store(i, cube[i]);
+    }
+
+    const auto check = [&](std::size_t threads) {
+      join_triangles(
+          vertices, std::span<const std::uint32_t>{cube_indices}, planes,
+          threads);
+
+      auto mismatches = 0UZ;
+      for (auto i = 0UZ; i != n; ++i) {
+        const auto& p0 = cube[cube_indices[3 * i]];
+        const auto& p1 = cube[cube_indices[3 * i + 1]];
+        const auto& p2 = cube[cube_indices[3 * i + 2]];
+
+        mismatches += std::size_t(planes[i] != wedge(wedge(p0, p1), p2));
+      }
+      return mismatches;
+    };
+
+    return expect(eq(0UZ, check(1)) and eq(0UZ, check(5)));
+  };
+
+  "vertices may be const"_test = [] {
+    auto vertex_columns = columns<G3::point>(3);
+    auto plane_columns = columns<G3::plane>(1);
+    const auto vertices = soa_span<G3::point>{vertex_columns};
+
+    vertices.store(0, G3::point{1, 0, 0, 0});
+    vertices.store(1, G3::point{1, 1, 0, 0});
+    vertices.store(2, G3::point{1, 0, 1, 0});
+
+    constexpr auto indices = std::array<std::uint64_t, 3>{0, 1, 2};
+    const auto planes = soa_span<G3::plane>{plane_columns};
+
+    join_triangles(
+        soa_span<const G3::point>{vertices},
+        std::span<const std::uint64_t>{indices},
+        planes);
+
+    return expect(
+        eq(wedge(wedge(vertices[0], vertices[1]), vertices[2]), planes[0]));
+  };
+
+  "aborts on mismatched number of indices"_test = [] {
+    return aborts([] {
+      auto vertex_columns = columns<G3::point>(3);
+      auto plane_columns = columns<G3::plane>(2);
+      constexpr auto indices = std::array<std::uint32_t, 3>{0, 1, 2};
+
+      join_triangles(
+          soa_span<G3::point>{vertex_columns},
+          std::span<const std::uint32_t>{indices},
+          soa_span<G3::plane>{plane_columns});
+    });
+  };
+
+  "aborts on out of range index"_test = [] {
+    return aborts([] {
+      auto vertex_columns = columns<G3::point>(3);
+      auto plane_columns = columns<G3::plane>(1);
+      constexpr auto indices = std::array<std::uint32_t, 3>{0, 1, 3};
+
+      join_triangles(
+          soa_span<G3::point>{vertex_columns},
+          std::span<const std::uint32_t>{indices},
+          soa_span<G3::plane>{plane_columns});
+    });
+  };
+}
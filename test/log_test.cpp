@@ -0,0 +1,83 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include "test/skytest_ext.hpp"
+
+#include <array>
+#include <cstddef>
+#include <numbers>
+#include <tuple>
+#include <type_traits>
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using bivector = G3::line::multivector_type;
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::approx_equal;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using ::rigid_geometric_algebra::exp;
+  using ::rigid_geometric_algebra::log;
+  using ::rigid_geometric_algebra::soa_span;
+
+  "log of a motor is a bivector"_test = [] {
+    return expect(
+        std::is_same_v<bivector, decltype(log(G3::motor::identity()))> and
+        std::is_same_v<
+            bivector,
+            decltype(log(G3::motor::identity().multivector()))>);
+  };
+
+  "log of the identity is zero"_test = [] {
+    return expect(eq(bivector{}, log(G3::motor::identity())));
+  };
+
+  "log is the inverse of exp"_test * std::tuple{
+      bivector{0.3, -0.2, 0.5, 0.7, 0.1, -0.4},
+      bivector{1.3, -0.9, 1.5, 0.7, 0.1, -0.4},
+      bivector{0, 0, 2.5, 0, -1, 0},
+      bivector{0, -3, 0, 0, 0, 0},
+      bivector{1e-4, 2e-4, -1e-4, 0.3, 0.2, 0.1},
+      bivector{1e-9, 0, 0, 1, 2, 3},
+      bivector{0, 0, 0, 1, 2, 3}} = [](const auto& l) {
+    return expect(approx_equal(l, log(exp(l))));
+  };
+
+  "log of a translator is a line at infinity"_test = [] {
+    return expect(
+        eq(bivector{0, 0, 0, -0.5, -1, 0},
+           log(G3::motor{0, 0, 0, 0, -0.5, -1, 0, 1})));
+  };
+
+  "log of a half turn"_test = [] {
+    return expect(approx_equal(
+        bivector{0, 0, std::numbers::pi / 2, 0, 0, 0},
+        log(G3::motor{0, 0, 0, 1, 0, 0, 0, 0})));
+  };
+
+  "batched log matches log"_test = [] {
+    const auto motors = std::array{
+        exp(bivector{0.3, -0.2, 0.5, 0.7, 0.1, -0.4}),
+        exp(bivector{1e-4, 2e-4, -1e-4, 0.3, 0.2, 0.1}),
+        G3::motor::identity()};
+
+    auto in =
+        std::array<std::array<double, motors.size()>, G3::motor::size>{};
+    auto out = std::array<std::array<double, motors.size()>, bivector::size>{};
+
+    const auto qs = soa_span<G3::motor>{in};
+    for (auto i = 0UZ; i != motors.size(); ++i) {
+      qs.store(i, motors[i]);
+    }
+
+    const auto ls = soa_span<bivector>{out};
+    log(soa_span<const G3::motor>{qs}, ls);
+
+    return expect(
+        eq(log(motors[0]), ls[0]) and eq(log(motors[1]), ls[1]) and
+        eq(log(motors[2]), ls[2]));
+  };
+}
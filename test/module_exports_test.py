@@ -0,0 +1,128 @@
+import re
+import sys
+import unittest
+from pathlib import Path
+
+# headers of the library, included with paths relative to the repository root
+INCLUDE = re.compile(r'#include "(rigid_geometric_algebra/[^/"]+\.hpp)"')
+
+# names exported by the module interface unit
+EXPORT = re.compile(r"using ::rigid_geometric_algebra::(\w+);")
+
+# comments, string and character literals, and template parameter lists do
+# not declare names of the enclosing namespace
+COMMENT = re.compile(r"//[^\n]*|/\*.*?\*/", re.DOTALL)
+LITERAL = re.compile(r'"(?:\\.|[^"\\])*"|\'(?:\\.|[^\'\\])\'')
+TEMPLATE = re.compile(r"\btemplate\s*<")
+
+# declarations of classes, concepts, aliases, variables, and functions
+DECLARATION = re.compile(
+    r"\b(?:class|struct|concept|enum(?:\s+class)?)\s+(\w+)"
+    r"|\busing\s+(\w+)\s*="
+    r"|\bauto\s*&?\s*(\w+)\s*[=(]",
+)
+
+# namespaces, braces, and objects declared with an unnamed class, as in
+# `struct { ... } name{};`
+SCOPE = re.compile(
+    r"(inline\s+)?namespace\s+([\w:]*)\s*\{"
+    r"|\{"
+    r"|\}(?:\s*(\w+)\s*(?=\{\s*\}\s*;))?",
+)
+
+
+def strip(text: str) -> str:
+    """Remove comments, literals, and template parameter lists."""
+    text = LITERAL.sub('""', COMMENT.sub("", text))
+
+    parts = []
+    pos = 0
+    while match := TEMPLATE.search(text, pos):
+        parts.append(text[pos : match.start()])
+        pos = match.end()
+        depth = 1
+        while depth:
+            depth += {"<": 1, ">": -1}.get(text[pos], 0)
+            pos += 1
+        parts.append(" template<> ")
+    parts.append(text[pos:])
+    return "".join(parts)
+
+
+def public_names(text: str) -> set[str]:
+    """Names declared in `rigid_geometric_algebra` or an inline namespace of it.
+
+    Names in `rigid_geometric_algebra::detail` and in class or function
+    scope are excluded.
+    """
+    text = strip(text)
+    names = set()
+    # whether each enclosing scope is a public namespace of the library
+    scopes: list[bool] = []
+    pos = 0
+
+    for match in SCOPE.finditer(text):
+        if scopes and scopes[-1]:
+            for declaration in DECLARATION.finditer(text, pos, match.start()):
+                names.update(filter(None, declaration.groups()))
+
+        scope = match.group(0)
+        if scope.startswith(("namespace", "inline")):
+            is_inline = match.group(1) is not None
+            scopes.append(
+                match.group(2) == "rigid_geometric_algebra"
+                or (is_inline and bool(scopes) and scopes[-1]),
+            )
+        elif scope == "{":
+            scopes.append(False)
+        else:
+            scopes.pop()
+            if match.group(3) and scopes and scopes[-1]:
+                names.add(match.group(3))
+        pos = match.end()
+
+    return names
+
+
+def included_headers(root: Path, header: str) -> list[str]:
+    """Library headers included by `header`, directly or indirectly.
+
+    Headers in `detail` are excluded.
+    """
+    headers = []
+    pending = [header]
+    while pending:
+        path = pending.pop()
+        if path not in headers:
+            headers.append(path)
+            pending += INCLUDE.findall((root / path).read_text())
+    return headers
+
+
+MODULE_INTERFACE: list[Path] = []
+
+
+class ModuleExportsTest(unittest.TestCase):
+    def setUp(self) -> None:
+        interface = MODULE_INTERFACE[0]
+        root = interface.parent.parent
+
+        self.declared = set()
+        for header in included_headers(
+            root,
+            "rigid_geometric_algebra/rigid_geometric_algebra.hpp",
+        ):
+            self.declared |= public_names((root / header).read_text())
+
+        self.exported = set(EXPORT.findall(interface.read_text()))
+
+    def test_public_names_are_exported(self) -> None:
+        self.assertEqual(set(), self.declared - self.exported)
+
+    def test_exported_names_are_declared(self) -> None:
+        self.assertEqual(set(), self.exported - self.declared)
+
+
+if __name__ == "__main__":
+    MODULE_INTERFACE.append(Path(sys.argv[1]))
+    unittest.main(argv=sys.argv[:1])
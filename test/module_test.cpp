@@ -0,0 +1,41 @@
+#include "skytest/skytest.hpp"
+
+// built as `module_test`, which imports the library module, and as
+// `module_header_test`, which includes the library headers, so that both
+// builds can be compared with the time_trace aspect
+#ifdef RIGID_GEOMETRIC_ALGEBRA_IMPORT_MODULE
+import rigid_geometric_algebra;
+#else
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#endif
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+  using ::rigid_geometric_algebra::antiwedge;
+  using ::rigid_geometric_algebra::geometric_antiproduct;
+  using ::rigid_geometric_algebra::wedge;
+
+  "geometric types"_ctest = [] {
+    const auto p = G3::point{1, 0, 0, 1};
+    const auto q = G3::point{0, 1, 0, 1};
+    const auto r = G3::point{0, 0, 1, 1};
+
+    const auto g = wedge(wedge(p, q), r);
+
+    return expect(eq(G3::plane{-1, -1, 1, -1}, g));
+  };
+
+  "multivector operations"_ctest = [] {
+    const auto g = G3::plane{1, 0, 0, 0}.multivector();
+    const auto h = G3::plane{0, 1, 0, 0}.multivector();
+
+    return expect(
+        eq(G3::line{0, 0, 1, 0, 0, 0}.multivector(), antiwedge(g, h)) and
+        eq(geometric_antiproduct(g, h), -geometric_antiproduct(h, g)));
+  };
+}
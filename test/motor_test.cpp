@@ -0,0 +1,108 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include "test/skytest_ext.hpp"
+
+#include <array>
+#include <format>
+#include <symengine/compat.hpp>
+#include <type_traits>
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::eq;
+  using ::skytest::equal_ranges;
+  using ::skytest::expect;
+
+  using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+  using GS3 = ::rigid_geometric_algebra::algebra<::SymEngine::Expression, 3>;
+
+  using ::rigid_geometric_algebra::antireverse;
+  using ::rigid_geometric_algebra::geometric_antiproduct;
+  using ::rigid_geometric_algebra::get;
+
+  static constexpr auto sandwich = [](const auto& q, const auto& x) {
+    return geometric_antiproduct(
+        geometric_antiproduct(q.multivector(), x.multivector()),
+        antireverse(q.multivector()));
+  };
+
+  static constexpr auto to_coefficients = [](const auto& v) {
+    return std::array{
+        get<G3::blade<0>>(v).coefficient,
+        get<G3::blade<1>>(v).coefficient,
+        get<G3::blade<2>>(v).coefficient,
+        get<G3::blade<3>>(v).coefficient};
+  };
+
+  "default constructible"_test = [] {
+    return expect(equal_ranges(std::array<double, 8>{}, G3::motor{}));
+  };
+
+  "contains elements of even antigrade"_test = [] {
+    using V = G3::motor::multivector_type;
+
+    return expect(
+        V::contains<G3::blade<>> and V::contains<G3::blade<0, 1>> and
+        V::contains<G3::blade<0, 2>> and V::contains<G3::blade<0, 3>> and
+        V::contains<G3::blade<2, 3>> and V::contains<G3::blade<3, 1>> and
+        V::contains<G3::blade<1, 2>> and V::contains<G3::blade<0, 1, 2, 3>> and
+        eq(8UZ, V::size));
+  };
+
+  "identity is the unit hypervolume"_test = [] {
+    const auto q = G3::motor{1, 2, 3, 4, 5, 6, 7, 8};
+
+    return expect(
+        eq(G3::motor{0, 0, 0, 0, 0, 0, 0, 1}, G3::motor::identity()) and
+        eq(q, geometric_antiproduct(G3::motor::identity(), q)) and
+        eq(q, geometric_antiproduct(q, G3::motor::identity())));
+  };
+
+  "identity is constructible for symengine"_test = [] {
+    return expect(
+        eq(GS3::motor{0, 0, 0, 0, 0, 0, 0, 1}, GS3::motor::identity()));
+  };
+
+  "composition of motors is a motor"_test = [] {
+    const auto q = G3::motor{1, 2, 3, 4, 5, 6, 7, 8};
+
+    return expect(std::is_same_v<
+                  G3::motor,
+                  decltype(geometric_antiproduct(q, q))>);
+  };
+
+  "sandwich with a line rotates about the line"_test = [] {
+    const auto q = G3::motor{0, 0, 0, 1, 0, 0, 0, 0};
+    const auto p = G3::point{1, 1, 2, 3};
+
+    return expect(equal_ranges(
+        std::array{1., -1., -2., 3.}, to_coefficients(sandwich(q, p))));
+  };
+
+  "sandwich with a translator translates"_test = [] {
+    const auto q = G3::motor{0, 0, 0, 0, -0.5, -1, 0, 1};
+    const auto p = G3::point{1, 1, 2, 3};
+
+    return expect(equal_ranges(
+        std::array{1., 2., 4., 3.}, to_coefficients(sandwich(q, p))));
+  };
+
+  "composition applies the right motor first"_test = [] {
+    const auto r = G3::motor{0, 0, 0, 1, 0, 0, 0, 0};
+    const auto t = G3::motor{0, 0, 0, 0, -0.5, -1, 0, 1};
+    const auto p = G3::point{1, 1, 2, 3};
+
+    return expect(equal_ranges(
+        std::array{1., -2., -4., 3.},
+        to_coefficients(sandwich(geometric_antiproduct(r, t), p))));
+  };
+
+  "formattable"_test = [] {
+    const auto q = GS3::motor{"s", "r1", "r2", "r3", "u1", "u2", "u3", "w"};
+
+    return expect(
+        eq(std::format("{}", q.multivector()), std::format("{}", q)));
+  };
+}
@@ -1,8 +1,11 @@
 #include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
 #include "skytest/skytest.hpp"
 
+#include <array>
+#include <bit>
 #include <format>
 #include <functional>
+#include <tuple>
 #include <type_traits>
 
 template <class T, class U>
@@ -199,4 +202,39 @@ auto main() -> int
                multivector{
                    G2::blade<>{0.3}, G2::blade<1>{2}, G2::blade<0, 1, 2>{2}})));
   };
+
+  "blades are stored without padding in canonical blade order"_ctest = [] {
+    using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+    using M = G3::motor::multivector_type;
+
+    const auto v = M{1, 2, 3, 4, 5, 6, 7, 8};
+    const auto expected = std::array{1., 2., 3., 4., 5., 6., 7., 8.};
+
+    return expect(
+        pred(std::is_trivially_copyable<M>{})() and
+        eq(sizeof(expected), sizeof(M)) and eq(expected, v.coefficients()) and
+        eq(expected, std::bit_cast<std::array<double, M::size>>(v)));
+  };
+
+  "as_tuple references lvalue blades and copies rvalue blades"_ctest = [] {
+    using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+    using M = G3::point::multivector_type;
+
+    auto v = M{1, 2, 3, 4};
+    std::get<1>(v.as_tuple()).coefficient = 5;
+
+    return expect(
+        pred(std::is_same<
+             std::tuple<
+                 G3::blade<0>&,
+                 G3::blade<1>&,
+                 G3::blade<2>&,
+                 G3::blade<3>&>,
+             decltype(v.as_tuple())>{})() and
+        pred(std::is_same<
+             std::tuple<G3::blade<0>, G3::blade<1>, G3::blade<2>, G3::blade<3>>,
+             decltype(M{}.as_tuple())>{})() and
+        eq(5., v.get<1>().coefficient) and
+        eq(2., std::get<1>(M{1, 2, 3, 4}.as_tuple()).coefficient));
+  };
 }
@@ -0,0 +1,94 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+using ::rigid_geometric_algebra::algebra;
+using ::rigid_geometric_algebra::antiwedge;
+using ::rigid_geometric_algebra::counted;
+using ::rigid_geometric_algebra::left_complement;
+using ::rigid_geometric_algebra::op_cost;
+using ::rigid_geometric_algebra::operation_counts;
+using ::rigid_geometric_algebra::right_complement;
+using ::rigid_geometric_algebra::wedge;
+
+using G3 = algebra<double, 3>;
+using C = counted<double>;
+using GC = algebra<C, 3>;
+
+static constexpr auto plus = std::plus<>{};
+
+// operations counted at run time with `counted<double>` coefficients
+template <class... Ts>
+auto runtime_cost(const auto& op) -> operation_counts
+{
+  const auto ones = []<class T>(std::type_identity<T>) {
+    using V = typename T::multivector_type;
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return V{(static_cast<void>(Is), C{1.})...};
+    }(std::make_index_sequence<V::size>{});
+  };
+
+  const auto args = std::tuple{ones(std::type_identity<Ts>{})...};
+
+  C::reset();
+  static_cast<void>(std::apply(op, args));
+  return C::counts();
+}
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  "wedge of two points"_ctest = [] {
+    constexpr auto cost = op_cost<wedge, G3::point, G3::point>;
+
+    return expect(
+        eq(12UZ, cost.multiplications) and eq(6UZ, cost.additions) and
+        eq(0UZ, cost.subtractions) and eq(0UZ, cost.divisions));
+  };
+
+  "sum of multivectors"_ctest = [] {
+    return expect(
+        eq(operation_counts{.additions = 4},
+           op_cost<plus, G3::point, G3::point>) and
+        eq(operation_counts{}, op_cost<plus, G3::point, G3::line>));
+  };
+
+  "operator with a zero result"_ctest = [] {
+    return expect(eq(0UZ, op_cost<wedge, G3::plane, G3::plane>.total()));
+  };
+
+  "blade arguments"_ctest = [] {
+    return expect(eq(
+        operation_counts{.multiplications = 1},
+        op_cost<wedge, G3::blade<1>, G3::blade<2>>));
+  };
+
+  "cost is independent of the field type"_ctest = [] {
+    using G3f = algebra<float, 3>;
+    return expect(eq(
+        op_cost<antiwedge, G3::line, G3::plane>,
+        op_cost<antiwedge, G3f::line, G3f::plane>));
+  };
+
+  "cost equals the run time operation count"_test = [] {
+    return expect(
+        eq(runtime_cost<GC::point, GC::point>(wedge),
+           op_cost<wedge, G3::point, G3::point>) and
+        eq(runtime_cost<GC::line, GC::point>(wedge),
+           op_cost<wedge, G3::line, G3::point>) and
+        eq(runtime_cost<GC::plane, GC::plane>(antiwedge),
+           op_cost<antiwedge, G3::plane, G3::plane>) and
+        eq(runtime_cost<GC::line, GC::plane>(antiwedge),
+           op_cost<antiwedge, G3::line, G3::plane>) and
+        eq(runtime_cost<GC::motor>(left_complement),
+           op_cost<left_complement, G3::motor>) and
+        eq(runtime_cost<GC::plane>(right_complement),
+           op_cost<right_complement, G3::plane>));
+  };
+}
@@ -0,0 +1,87 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include <compare>
+#include <cmath>
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using ::rigid_geometric_algebra::orientation;
+  using ::rigid_geometric_algebra::orientation_stage;
+
+  using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+  using std::partial_ordering;
+
+  // z = 1
+  static constexpr auto g = G3::plane{0, 0, 1, -1};
+
+  "point and plane"_test = [] {
+    return expect(
+        eq(partial_ordering::greater, orientation(g, G3::point{1, 0, 0, 2})) and
+        eq(partial_ordering::less, orientation(g, G3::point{1, 5, 5, 0})) and
+        eq(partial_ordering::equivalent,
+           orientation(g, G3::point{1, 5, 5, 1})));
+  };
+
+  "four points"_test = [] {
+    const auto p0 = G3::point{1, 0, 0, 0};
+    const auto p1 = G3::point{1, 1, 0, 0};
+    const auto p2 = G3::point{1, 0, 1, 0};
+
+    return expect(
+        eq(partial_ordering::greater,
+           orientation(p0, p1, p2, G3::point{1, 0, 0, 1})) and
+        eq(partial_ordering::less,
+           orientation(p0, p2, p1, G3::point{1, 0, 0, 1})) and
+        eq(partial_ordering::equivalent,
+           orientation(p0, p1, p2, G3::point{1, 3, 4, 0})));
+  };
+
+  "intersecting lines"_test = [] {
+    const auto o = G3::point{1, 0, 0, 0};
+    const auto l1 = o ^ G3::point{1, 1, 0, 0};
+    const auto l2 = o ^ G3::point{1, 0, 1, 0};
+
+    return expect(eq(partial_ordering::equivalent, orientation(l1, l2)));
+  };
+
+  "well separated values are decided by the filter"_test = [] {
+    auto stage = orientation_stage{};
+    const auto result = orientation(stage, g, G3::point{1, 0.1, 0.2, 2});
+
+    return expect(
+        eq(partial_ordering::greater, result) and
+        stage == orientation_stage::filter);
+  };
+
+  "small values fall back to intervals"_test = [] {
+    const auto p0 = G3::point{1, 0, 0, 0};
+    const auto p1 = G3::point{1, 1, 0, 0};
+    const auto p2 = G3::point{1, 0, 1, 0};
+
+    auto stage = orientation_stage{};
+    const auto result =
+        orientation(stage, p0, p1, p2, G3::point{1, 0.5, 0.5, 1e-30});
+
+    return expect(
+        eq(partial_ordering::greater, result) and
+        stage == orientation_stage::interval);
+  };
+
+  "sign is certain near a plane"_test = [] {
+    // the nearest doubles above and below z = 1
+    const auto above = std::nextafter(1., 2.);
+    const auto below = std::nextafter(1., 0.);
+
+    return expect(
+        eq(partial_ordering::greater,
+           orientation(g, G3::point{1, 0.1, 0.7, above})) and
+        eq(partial_ordering::less,
+           orientation(g, G3::point{1, 0.1, 0.7, below})));
+  };
+}
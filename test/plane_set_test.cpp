@@ -0,0 +1,168 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+#include "support/soa_columns.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using ::rigid_geometric_algebra::antiwedge;
+using ::rigid_geometric_algebra::containment;
+using ::rigid_geometric_algebra::plane_set;
+using ::rigid_geometric_algebra::soa_span;
+using ::support::columns;
+
+// |x| <= 1, |y| <= 1, |z| <= 1
+const auto cube = plane_set<G3, 6>{std::array{
+    G3::plane{1, 0, 0, -1},
+    G3::plane{-1, 0, 0, -1},
+    G3::plane{0, 1, 0, -1},
+    G3::plane{0, -1, 0, -1},
+    G3::plane{0, 0, 1, -1},
+    G3::plane{0, 0, -1, -1}}};
+
+// frustum with a 90 degree field of view along z, with 1 <= z <= 10
+const auto frustum_planes = std::array{
+    G3::plane{0, 0, -1, 1},
+    G3::plane{0, 0, 1, -10},
+    G3::plane{1, 0, -1, 0},
+    G3::plane{-1, 0, -1, 0},
+    G3::plane{0, 1, -1, 0},
+    G3::plane{0, -1, -1, 0}};
+
+auto side(const G3::plane& g, const G3::point& p) -> double
+{
+  return antiwedge(g.multivector(), p.multivector())
+      .template get<0>()
+      .coefficient;
+}
+
+// classification from the sides of the corners of a box
+auto expected(const G3::point& center, const G3::point& extent) -> containment
+{
+  auto inside = true;
+  for (const auto& g : frustum_planes) {
+    auto above = 0UZ;
+    for (const auto sx : {-1., 1.}) {
+      for (const auto sy : {-1., 1.}) {
+        for (const auto sz : {-1., 1.}) {
+          const auto w = center[0];
+          const auto corner = G3::point{
+              w,
+              center[1] + sx * w * extent[1],
+              center[2] + sy * w * extent[2],
+              center[3] + sz * w * extent[3]};
+          above += std::size_t(side(g, corner) > 0.);
+          inside = inside and side(g, corner) < 0.;
+        }
+      }
+    }
+    if (above == 8) {
+      return containment::outside;
+    }
+  }
+  return inside ? containment::inside : containment::straddling;
+}
+
+}  // namespace
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::aborts;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  "planes are stored"_test = [] {
+    const auto frustum = plane_set<G3, 6>{frustum_planes};
+
+    auto mismatches = 0UZ;
+    for (auto k = 0UZ; k != frustum.size(); ++k) {
+      mismatches += std::size_t(frustum[k] != frustum_planes[k]);
+    }
+
+    return expect(eq(6UZ, frustum.size()) and eq(0UZ, mismatches));
+  };
+
+  "classify points"_test = [] {
+    return expect(
+        cube.classify(G3::point{1, 0, 0, 0}) == containment::inside and
+        cube.classify(G3::point{1, 2, 0, 0}) == containment::outside and
+        cube.classify(G3::point{1, 1, 0, 0}) == containment::straddling and
+        cube.classify(G3::point{2, 1, 1, -1}) == containment::inside and
+        cube.classify(G3::point{2, 4, 0, 0}) == containment::outside);
+  };
+
+  "classify boxes"_test = [] {
+    const auto extent = G3::point{0, 0.5, 0.25, 0.5};
+
+    const auto classify = [&extent](const G3::point& center) {
+      return cube.classify(center, extent);
+    };
+
+    return expect(
+        classify(G3::point{1, 0, 0, 0}) == containment::inside and
+        classify(G3::point{1, 3, 0, 0}) == containment::outside and
+        classify(G3::point{1, 1, 0, 0}) == containment::straddling and
+        classify(G3::point{2, 0, 0, 3.2}) == containment::outside and
+        classify(G3::point{2, 0, 0, 2.5}) == containment::straddling);
+  };
+
+  "batches match the sides of box corners"_test = [] {
+    constexpr auto n = 1000UZ;
+
+    auto rng = std::mt19937{0};
+    auto position = std::uniform_real_distribution{-12.0, 12.0};
+    auto size = std::uniform_real_distribution{0.0, 2.0};
+    auto weight = std::uniform_real_distribution{0.5, 2.0};
+
+    auto center_columns = columns<G3::point>(n);
+    auto extent_columns = columns<G3::point>(n);
+    const auto centers = soa_span<G3::point>{center_columns};
+    const auto extents = soa_span<G3::point>{extent_columns};
+
+    for (auto i = 0UZ; i != n; ++i) {
+      const auto w = weight(rng);
+      centers.store(
+          i,
+          G3::point{
+              w, w * position(rng), w * position(rng), w * position(rng)});
+      extents.store(i, G3::point{0, size(rng), size(rng), size(rng)});
+    }
+
+    const auto frustum = plane_set<G3, 6>{frustum_planes};
+
+    auto points = std::vector<containment>(n);
+    auto boxes = std::vector<containment>(n);
+    frustum.classify(soa_span<const G3::point>{centers}, std::span{points});
+    frustum.classify(centers, extents, std::span{boxes});
+
+    auto mismatches = 0UZ;
+    for (auto i = 0UZ; i != n; ++i) {
+      mismatches += std::size_t(
+          points[i] != expected(centers[i], G3::point{}) or
+          boxes[i] != expected(centers[i], extents[i]));
+    }
+
+    return expect(
+        eq(0UZ, mismatches) and
+        std::ranges::find(boxes, containment::inside) != boxes.end() and
+        std::ranges::find(boxes, containment::outside) != boxes.end() and
+        std::ranges::find(boxes, containment::straddling) != boxes.end());
+  };
+
+  "aborts on mismatched batch sizes"_test = [] {
+    return aborts([] {
+      auto point_columns = columns<G3::point>(2);
+      auto out = std::vector<containment>(1);
+
+      cube.classify(soa_span<G3::point>{point_columns}, std::span{out});
+    });
+  };
+}
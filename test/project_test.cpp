@@ -0,0 +1,189 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+  using ::rigid_geometric_algebra::antiproject;
+  using ::rigid_geometric_algebra::expand;
+  using ::rigid_geometric_algebra::get;
+  using ::rigid_geometric_algebra::project;
+  using ::rigid_geometric_algebra::soa_span;
+  using ::rigid_geometric_algebra::weight_contraction;
+  using ::rigid_geometric_algebra::weight_dual;
+
+  // x = 2
+  static constexpr auto g = G3::plane{1, 0, 0, -2};
+  // z axis
+  static constexpr auto l = G3::line{0, 0, 1, 0, 0, 0};
+  static constexpr auto p = G3::point{1, 5, 3, 4};
+
+  "weight dual of a plane is its normal direction"_test = [] {
+    const auto n = weight_dual(G3::plane{1, 2, 3, 4}.multivector());
+
+    return expect(
+        eq(3UZ, decltype(n)::size) and
+        eq(1., get<G3::blade<1>>(n).coefficient) and
+        eq(2., get<G3::blade<2>>(n).coefficient) and
+        eq(3., get<G3::blade<3>>(n).coefficient));
+  };
+
+  "result types depend on the geometric types"_test = [] {
+    return expect(
+        std::is_same_v<G3::line, decltype(expand(p, g))> and
+        std::is_same_v<G3::plane, decltype(expand(p, l))> and
+        std::is_same_v<G3::point, decltype(project(p, g))> and
+        std::is_same_v<G3::point, decltype(project(p, l))> and
+        std::is_same_v<G3::line, decltype(project(l, g))> and
+        std::is_same_v<G3::plane, decltype(antiproject(g, p))> and
+        std::is_same_v<G3::line, decltype(antiproject(l, p))> and
+        std::is_same_v<G3::plane, decltype(antiproject(g, l))> and
+        std::is_same_v<
+            decltype(project(p.multivector(), g.multivector())),
+            G3::point::multivector_type>);
+  };
+
+  "expansion of a point onto a plane is perpendicular to the plane"_test =
+      [] { return expect(eq(G3::line{1, 0, 0, 0, 4, -3}, expand(p, g))); };
+
+  "weight contraction of a plane onto a point is at infinity"_test = [] {
+    const auto c = weight_contraction(
+        g.multivector(), G3::point{1, 0, 0, 0}.multivector());
+
+    return expect(
+        eq(3UZ, decltype(c)::size) and
+        eq(1., get<G3::blade<2, 3>>(c).coefficient) and
+        eq(0., get<G3::blade<3, 1>>(c).coefficient) and
+        eq(0., get<G3::blade<1, 2>>(c).coefficient));
+  };
+
+  "point projected onto a plane"_test = [] {
+    return expect(eq(G3::point{1, 2, 3, 4}, project(p, g)));
+  };
+
+  "point projected onto a line"_test = [] {
+    return expect(eq(G3::point{1, 0, 0, 4}, project(p, l)));
+  };
+
+  "projection is scaled by the squared weight norm"_test = [] {
+    return expect(
+        eq(G3::point{12, 24, 36, 48},
+           project(G3::point{3, 15, 9, 12}, G3::plane{2, 0, 0, -4})));
+  };
+
+  "line projected onto a plane"_test = [] {
+    // line through (0, 0, 0) and (1, 1, 1) projected onto z = 0
+    const auto m = G3::point{1, 0, 0, 0} ^ G3::point{1, 1, 1, 1};
+    const auto expected = G3::point{1, 0, 0, 0} ^ G3::point{1, 1, 1, 0};
+
+    return expect(eq(expected, project(m, G3::plane{0, 0, 1, 0})));
+  };
+
+  "plane antiprojected onto a point"_test = [] {
+    return expect(eq(G3::plane{1, 0, 0, -5}, antiproject(g, p)));
+  };
+
+  "batched projection onto one plane"_test = [] {
+    auto in = std::array<std::vector<double>, G3::point::size>{
+        std::vector{1., 1.},
+        std::vector{5., 0.},
+        std::vector{3., 1.},
+        std::vector{4., 2.}};
+    auto out = std::array<std::vector<double>, G3::point::size>{};
+    for (auto& column : out) {
+      column.resize(2);
+    }
+
+    const auto ps = soa_span<const G3::point>{in};
+    const auto qs = soa_span<G3::point>{out};
+
+    project(ps, g, qs);
+
+    return expect(
+        eq(project(ps[0], g), qs[0]) and eq(project(ps[1], g), qs[1]));
+  };
+
+  "batched projection onto many lines"_test = [] {
+    auto in = std::array<std::vector<double>, G3::point::size>{
+        std::vector{1.}, std::vector{5.}, std::vector{3.}, std::vector{4.}};
+    auto lines = std::array<std::vector<double>, G3::line::size>{
+        std::vector{1.},
+        std::vector{0.},
+        std::vector{0.},
+        std::vector{0.},
+        std::vector{0.},
+        std::vector{0.}};
+    auto out = std::array<std::vector<double>, G3::point::size>{};
+    for (auto& column : out) {
+      column.resize(1);
+    }
+
+    const auto qs = soa_span<G3::point>{out};
+
+    project(
+        soa_span<const G3::point>{in}, soa_span<const G3::line>{lines}, qs);
+
+    return expect(eq(G3::point{1, 5, 0, 0}, qs[0]));
+  };
+
+  "batched expansion onto one plane"_test = [] {
+    auto in = std::array<std::vector<double>, G3::point::size>{
+        std::vector{1., 1.},
+        std::vector{5., 0.},
+        std::vector{3., 1.},
+        std::vector{4., 2.}};
+    auto out = std::array<std::vector<double>, G3::line::size>{};
+    for (auto& column : out) {
+      column.resize(2);
+    }
+
+    const auto ps = soa_span<const G3::point>{in};
+    const auto ls = soa_span<G3::line>{out};
+
+    expand(ps, g, ls);
+
+    return expect(
+        eq(expand(ps[0], g), ls[0]) and eq(expand(ps[1], g), ls[1]));
+  };
+
+  "batched weight contraction onto many points"_test = [] {
+    using plane = G3::plane::multivector_type;
+    using point = G3::point::multivector_type;
+    using V = decltype(weight_contraction(plane{}, point{}));
+
+    auto planes = std::array<std::vector<double>, plane::size>{
+        std::vector{1., 0.},
+        std::vector{0., 1.},
+        std::vector{0., 0.},
+        std::vector{-2., 3.}};
+    auto points = std::array<std::vector<double>, point::size>{
+        std::vector{1., 2.},
+        std::vector{0., 1.},
+        std::vector{0., 0.},
+        std::vector{0., 1.}};
+    auto out = std::array<std::vector<double>, V::size>{};
+    for (auto& column : out) {
+      column.resize(2);
+    }
+
+    const auto gs = soa_span<const plane>{planes};
+    const auto ps = soa_span<const point>{points};
+    const auto cs = soa_span<V>{out};
+
+    weight_contraction(gs, ps, cs);
+
+    return expect(
+        eq(weight_contraction(gs[0], ps[0]), cs[0]) and
+        eq(weight_contraction(gs[1], ps[1]), cs[1]));
+  };
+}
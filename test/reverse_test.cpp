@@ -0,0 +1,70 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include <tuple>
+
+using ::rigid_geometric_algebra::antireverse;
+using ::rigid_geometric_algebra::geometric_antiproduct;
+using ::rigid_geometric_algebra::geometric_product;
+using ::rigid_geometric_algebra::left_complement;
+using ::rigid_geometric_algebra::reverse;
+using ::rigid_geometric_algebra::right_complement;
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+
+  "reverse of blades"_ctest = [] {
+    return expect(
+        eq(G3::blade<>{1}, reverse(G3::blade<>{1})) and
+        eq(G3::blade<1>{1}, reverse(G3::blade<1>{1})) and
+        eq(G3::blade<1, 2>{-1}, reverse(G3::blade<1, 2>{1})) and
+        eq(G3::blade<0, 1, 2>{-1}, reverse(G3::blade<0, 1, 2>{1})) and
+        eq(G3::blade<0, 1, 2, 3>{1}, reverse(G3::blade<0, 1, 2, 3>{1})));
+  };
+
+  "antireverse of blades"_ctest = [] {
+    return expect(
+        eq(G3::blade<>{1}, antireverse(G3::blade<>{1})) and
+        eq(G3::blade<1>{-1}, antireverse(G3::blade<1>{1})) and
+        eq(G3::blade<1, 2>{-1}, antireverse(G3::blade<1, 2>{1})) and
+        eq(G3::blade<0, 1, 2>{1}, antireverse(G3::blade<0, 1, 2>{1})) and
+        eq(G3::blade<0, 1, 2, 3>{1}, antireverse(G3::blade<0, 1, 2, 3>{1})));
+  };
+
+  "reverse is an involution"_ctest * std::tuple{
+      G3::blade<0>{2},
+      G3::blade<2, 3>{3},
+      G3::blade<0, 3, 1>{4}} = [](auto b) {
+    return expect(
+        eq(b, reverse(reverse(b))) and eq(b, antireverse(antireverse(b))));
+  };
+
+  "reverse of a product is the product of reverses"_ctest = [] {
+    const auto a = G3::blade<1>{1} + G3::blade<0, 2>{2} + G3::blade<>{3};
+    const auto b = G3::blade<3, 1>{4} + G3::blade<0, 1, 2>{5};
+
+    return expect(
+        eq(reverse(geometric_product(a, b)),
+           geometric_product(reverse(b), reverse(a))) and
+        eq(antireverse(geometric_antiproduct(a, b)),
+           geometric_antiproduct(antireverse(b), antireverse(a))));
+  };
+
+  "antireverse is the dual of reverse"_ctest = [] {
+    const auto a = G3::blade<1>{1} + G3::blade<0, 2>{2} + G3::blade<>{3};
+
+    return expect(eq(
+        left_complement(reverse(right_complement(a))), antireverse(a)));
+  };
+
+  "reverse of a line is a line"_test = [] {
+    return expect(
+        eq(G3::line{-1, 0, 0, 0, -2, 0},
+           antireverse(G3::line{1, 0, 0, 0, 2, 0})));
+  };
+}
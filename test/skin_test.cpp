@@ -0,0 +1,235 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+#include "support/soa_columns.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace {
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using ::rigid_geometric_algebra::exp;
+using ::rigid_geometric_algebra::skin;
+using ::rigid_geometric_algebra::soa_span;
+using ::rigid_geometric_algebra::transform;
+using ::support::columns;
+
+auto near(const G3::point& p, const G3::point& q) -> bool
+{
+  return std::abs(p[0] - q[0]) < 1e-12 and std::abs(p[1] - q[1]) < 1e-12 and
+         std::abs(p[2] - q[2]) < 1e-12 and std::abs(p[3] - q[3]) < 1e-12;
+}
+
+// translation by `(x, y, z)`
+auto translation(double x, double y, double z) -> G3::motor
+{
+  return G3::motor{0, 0, 0, 0, -x / 2, -y / 2, -z / 2, 1};
+}
+
+// screw motions about lines through random points
+auto random_motors(std::size_t n) -> std::vector<G3::motor>
+{
+  auto rng = std::mt19937{0};
+  auto dist = std::uniform_real_distribution{-1.0, 1.0};
+
+  const auto point = [&] {
+    return G3::point{1, dist(rng), dist(rng), dist(rng)};
+  };
+
+  auto motors = std::vector<G3::motor>{};
+  for (auto i = 0UZ; i != n; ++i) {
+    motors.push_back(exp(point() ^ point()));
+  }
+  return motors;
+}
+
+// a rest pose of random vertices with random weights
+auto random_vertices(std::size_t n)
+{
+  auto rng = std::mt19937{1};
+  auto dist = std::uniform_real_distribution{-1.0, 1.0};
+  auto weight = std::uniform_real_distribution{0.5, 2.0};
+
+  auto c = columns<G3::point>(n);
+  for (auto i = 0UZ; i != n; ++i) {
+    const auto w = weight(rng);
+    soa_span<G3::point>{c}.store(
+        i, G3::point{w, w * dist(rng), w * dist(rng), w * dist(rng)});
+  }
+  return c;
+}
+
+}  // namespace
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::aborts;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  "single bone matches transform"_test = [] {
+    constexpr auto n = 50UZ;
+
+    const auto palette = random_motors(8);
+
+    auto weights = std::vector<std::array<double, 1>>(n, {1.0});
+    auto indices = std::vector<std::array<std::uint8_t, 1>>{};
+    for (auto i = 0UZ; i != n; ++i) {
+      indices.push_back({static_cast<std::uint8_t>(i % palette.size())});
+    }
+
+    auto vertex_columns = random_vertices(n);
+    auto out_columns = columns<G3::point>(n);
+    const auto vertices = soa_span<const G3::point>{vertex_columns};
+    const auto out = soa_span<G3::point>{out_columns};
+
+    skin(
+        std::span<const G3::motor>{palette},
+        std::span<const std::array<double, 1>>{weights},
+        std::span<const std::array<std::uint8_t, 1>>{indices},
+        vertices,
+        out);
+
+    auto mismatches = 0UZ;
+    for (auto i = 0UZ; i != n; ++i) {
+      mismatches += std::size_t(
+          not near(transform(palette[indices[i][0]], vertices[i]), out[i]));
+    }
+
+    return expect(eq(0UZ, mismatches));
+  };
+
+  "blended translations are averaged"_test = [] {
+    const auto palette =
+        std::array{translation(2, 0, 0), translation(0, 4, 0)};
+
+    // unnormalized weights
+    const auto weights = std::array{
+        std::array{2.0, 2.0}, std::array{3.0, 1.0}, std::array{0.0, 5.0}};
+    const auto indices = std::array{
+        std::array<std::uint32_t, 2>{0, 1},
+        std::array<std::uint32_t, 2>{0, 1},
+        std::array<std::uint32_t, 2>{0, 1}};
+
+    auto vertex_columns = columns<G3::point>(3);
+    auto out_columns = columns<G3::point>(3);
+    const auto vertices = soa_span<G3::point>{vertex_columns};
+    const auto out = soa_span<G3::point>{out_columns};
+
+    vertices.store(0, G3::point{1, 0, 0, 0});
+    vertices.store(1, G3::point{2, 2, 0, 0});
+    vertices.store(2, G3::point{1, 0, 0, 1});
+
+    skin(
+        std::span<const G3::motor>{palette},
+        std::span<const std::array<double, 2>>{weights},
+        std::span<const std::array<std::uint32_t, 2>>{indices},
+        vertices,
+        out);
+
+    return expect(
+        near(G3::point{1, 1, 2, 0}, out[0]) and
+        near(G3::point{2, 5, 2, 0}, out[1]) and
+        near(G3::point{1, 0, 4, 1}, out[2]));
+  };
+
+  "motors of opposite sign blend alike"_test = [] {
+    constexpr auto n = 100UZ;
+
+    const auto palette = random_motors(4);
+    auto flipped = palette;
+    for (auto& m : flipped) {
+      m = G3::motor{-m.multivector()};
+    }
+    flipped[0] = palette[0];
+
+    auto rng = std::mt19937{2};
+    auto bone = std::uniform_int_distribution<std::uint16_t>{0, 3};
+    auto weight = std::uniform_real_distribution{0.0, 1.0};
+
+    auto weights = std::vector<std::array<double, 4>>{};
+    auto indices = std::vector<std::array<std::uint16_t, 4>>{};
+    for (auto i = 0UZ; i != n; ++i) {
+      weights.push_back({weight(rng), weight(rng), weight(rng), weight(rng)});
+      indices.push_back({bone(rng), bone(rng), bone(rng), bone(rng)});
+    }
+
+    auto vertex_columns = random_vertices(n);
+    auto out_columns = columns<G3::point>(n);
+    auto flipped_columns = columns<G3::point>(n);
+    const auto vertices = soa_span<const G3::point>{vertex_columns};
+    const auto out = soa_span<G3::point>{out_columns};
+    const auto flipped_out = soa_span<G3::point>{flipped_columns};
+
+    const auto w = std::span<const std::array<double, 4>>{weights};
+    const auto idx = std::span<const std::array<std::uint16_t, 4>>{indices};
+
+    skin(std::span<const G3::motor>{palette}, w, idx, vertices, out);
+    skin(std::span<const G3::motor>{flipped}, w, idx, vertices, flipped_out);
+
+    auto mismatches = 0UZ;
+    for (auto i = 0UZ; i != n; ++i) {
+      mismatches += std::size_t(not near(out[i], flipped_out[i]));
+    }
+
+    return expect(eq(0UZ, mismatches));
+  };
+
+  "threads partition vertices"_test = [] {
+    constexpr auto n = 101UZ;
+
+    const auto palette = random_motors(16);
+
+    auto rng = std::mt19937{3};
+    auto bone = std::uniform_int_distribution<std::uint16_t>{0, 15};
+    auto weight = std::uniform_real_distribution{0.0, 1.0};
+
+    auto weights = std::vector<std::array<double, 2>>{};
+    auto indices = std::vector<std::array<std::uint16_t, 2>>{};
+    for (auto i = 0UZ; i != n; ++i) {
+      weights.push_back({weight(rng), weight(rng)});
+      indices.push_back({bone(rng), bone(rng)});
+    }
+
+    auto vertex_columns = random_vertices(n);
+    const auto vertices = soa_span<const G3::point>{vertex_columns};
+
+    const auto run = [&](std::size_t threads) {
+      auto c = columns<G3::point>(n);
+      skin(
+          std::span<const G3::motor>{palette},
+          std::span<const std::array<double, 2>>{weights},
+          std::span<const std::array<std::uint16_t, 2>>{indices},
+          vertices,
+          soa_span<G3::point>{c},
+          threads);
+      return c;
+    };
+
+    return expect(run(1) == run(4));
+  };
+
+  "aborts on out of range bone index"_test = [] {
+    return aborts([] {
+      const auto palette = std::array{translation(1, 0, 0)};
+      const auto weights = std::array<std::array<double, 1>, 1>{{{1.0}}};
+      const auto indices = std::array<std::array<std::uint32_t, 1>, 1>{{{1}}};
+
+      auto vertex_columns = columns<G3::point>(1);
+      auto out_columns = columns<G3::point>(1);
+
+      skin(
+          std::span<const G3::motor>{palette},
+          std::span<const std::array<double, 1>>{weights},
+          std::span<const std::array<std::uint32_t, 1>>{indices},
+          soa_span<G3::point>{vertex_columns},
+          soa_span<G3::point>{out_columns});
+    });
+  };
+}
@@ -3,6 +3,7 @@
 #include "skytest/skytest.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <utility>
 
@@ -44,4 +45,31 @@ inline constexpr auto equal_elements =
       }(std::make_index_sequence<T::size>{});
     };
 
+/// compares the coefficients of multivectors, or the elements of ranges,
+/// within an absolute tolerance
+///
+/// Coefficients are converted to `double` before comparison, so that
+/// multivectors over different fields can be compared.
+///
+inline constexpr auto approx_equal = pred(
+    []<class T1, class T2>(
+        const T1& x, const T2& y, double tolerance = 1e-12) {
+      const auto near = [tolerance](const auto& a, const auto& b) {
+        return std::abs(static_cast<double>(a) - static_cast<double>(b)) <=
+               tolerance;
+      };
+
+      if constexpr (requires { x.template get<0>().coefficient; }) {
+        return [&]<std::size_t... i>(std::index_sequence<i...>) {
+          return (
+              near(
+                  x.template get<i>().coefficient,
+                  y.template get<i>().coefficient) and
+              ...);
+        }(std::make_index_sequence<T1::size>{});
+      } else {
+        return std::ranges::equal(x, y, near);
+      }
+    });
+
 }  // namespace skytest
@@ -0,0 +1,122 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include "test/skytest_ext.hpp"
+
+#include <array>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::aborts;
+  using ::skytest::eq;
+  using ::skytest::equal_ranges;
+  using ::skytest::expect;
+
+  using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+  using ::rigid_geometric_algebra::soa_span;
+
+  "default constructible"_test = [] {
+    const auto s = soa_span<G3::point>{};
+
+    return expect(eq(0UZ, s.size()) and s.empty());
+  };
+
+  "loads elements from columns"_test = [] {
+    auto columns = std::array{
+        std::array{1., 1.}, std::array{2., 5.}, std::array{3., 6.},
+        std::array{4., 7.}};
+
+    const auto s = soa_span<const G3::point>{columns};
+
+    return expect(
+        eq(2UZ, s.size()) and eq(G3::point{1, 2, 3, 4}, s[0]) and
+        eq(G3::point{1, 5, 6, 7}, s[1]));
+  };
+
+  "stores elements to columns"_test = [] {
+    auto columns = std::array<std::vector<double>, G3::point::size>{};
+    for (auto& c : columns) {
+      c.resize(2);
+    }
+
+    const auto s = soa_span<G3::point>{columns};
+    s.store(1, G3::point{1, 2, 3, 4});
+
+    return expect(
+        equal_ranges(std::array{0., 1.}, columns[0]) and
+        equal_ranges(std::array{0., 2.}, columns[1]) and
+        equal_ranges(std::array{0., 3.}, columns[2]) and
+        equal_ranges(std::array{0., 4.}, columns[3]));
+  };
+
+  "columns are contiguous"_test = [] {
+    auto columns = std::array<std::array<double, 3>, G3::line::size>{};
+    const auto s = soa_span<G3::line>{columns};
+
+    return expect(
+        eq(columns[0].data(), s.column(0).data()) and
+        eq(columns[5].data(), s.column(5).data()) and
+        eq(3UZ, s.column(5).size()));
+  };
+
+  "data points to each column"_test = [] {
+    auto columns = std::array<std::array<double, 3>, G3::line::size>{};
+    const auto s = soa_span<G3::line>{columns}.subspan(1, 2);
+
+    return expect(
+        eq(columns[0].data() + 1, s.data()[0]) and
+        eq(columns[5].data() + 1, s.data()[5]));
+  };
+
+  "subspan partitions elements"_test = [] {
+    auto columns = std::array{
+        std::array{1., 1., 1.}, std::array{2., 5., 8.}, std::array{3., 6., 9.},
+        std::array{4., 7., 10.}};
+
+    const auto s = soa_span<const G3::point>{columns}.subspan(1, 2);
+
+    return expect(
+        eq(2UZ, s.size()) and eq(G3::point{1, 5, 6, 7}, s[0]) and
+        eq(G3::point{1, 8, 9, 10}, s[1]));
+  };
+
+  "convertible to const"_test = [] {
+    return expect(
+        std::is_convertible_v<
+            soa_span<G3::point>,
+            soa_span<const G3::point>> and
+        not std::is_convertible_v<
+            soa_span<const G3::point>,
+            soa_span<G3::point>>);
+  };
+
+  "supports multivector elements"_test = [] {
+    using V = G3::multivector<{}, {0, 1, 2, 3}>;
+
+    auto columns = std::array{std::array{2.}, std::array{3.}};
+    const auto s = soa_span<V>{columns};
+
+    return expect(eq(V{2, 3}, s[0]));
+  };
+
+  "aborts on mismatched column sizes"_test = [] {
+    return expect(aborts([] {
+      auto columns = std::array{
+          std::vector{1., 1.}, std::vector{1.}, std::vector{1.},
+          std::vector{1.}};
+      std::ignore = soa_span<G3::point>{columns};
+    }));
+  };
+
+  "aborts on out of range access"_test = [] {
+    return expect(aborts([] {
+      auto columns = std::array<std::array<double, 1>, G3::point::size>{};
+      std::ignore = soa_span<G3::point>{columns}[1];
+    }));
+  };
+}
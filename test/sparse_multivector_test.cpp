@@ -0,0 +1,131 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+
+#include <type_traits>
+
+using ::rigid_geometric_algebra::algebra;
+using ::rigid_geometric_algebra::antiwedge;
+using ::rigid_geometric_algebra::geometric_antiproduct;
+using ::rigid_geometric_algebra::geometric_product;
+using ::rigid_geometric_algebra::sparse_multivector;
+using ::rigid_geometric_algebra::wedge;
+
+using G2 = algebra<double, 2>;
+using G3 = algebra<double, 3>;
+using G4 = algebra<double, 4>;
+using sparse = sparse_multivector<G3>;
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::aborts;
+  using ::skytest::eq;
+  using ::skytest::expect;
+  using ::skytest::ne;
+
+  "coefficients are packed in blade mask order"_test = [] {
+    // e0 + 2e1 + 3e2 + 4e3
+    constexpr auto x = sparse{G3::point{1, 2, 3, 4}};
+
+    return expect(
+        eq(0b1'0001'0110UZ, x.blades()) and eq(4UZ, x.size()) and
+        eq(1., x.coefficients()[0]) and eq(2., x.coefficients()[1]) and
+        eq(3., x.coefficients()[2]) and eq(4., x.coefficients()[3]) and
+        eq(3., x.coefficient(0b0100)) and eq(0., x.coefficient(0b0110)));
+  };
+
+  "converts from and to multivector"_ctest = [] {
+    constexpr auto p = G3::point{1, 2, 3, 4};
+    constexpr auto l = G3::line{1, 2, 3, 3, 0, -1};
+
+    using V = decltype(p.multivector() + l.multivector());
+
+    return expect(
+        eq(p.multivector(),
+           static_cast<G3::point::multivector_type>(sparse{p})) and
+        eq(l.multivector(),
+           static_cast<G3::line::multivector_type>(sparse{l})) and
+        eq(p.multivector() + l.multivector(),
+           static_cast<V>(sparse{p} + sparse{l})) and
+        eq(G3::motor::multivector_type{},
+           static_cast<G3::motor::multivector_type>(sparse{})));
+  };
+
+  "conversion requires blades of the target type"_test = [] {
+    return aborts([] {
+      static_cast<void>(
+          static_cast<G3::point::multivector_type>(sparse{G3::line{}}));
+    });
+  };
+
+  "coefficient requires a blade of the algebra"_test = [] {
+    return aborts([] { static_cast<void>(sparse{}.coefficient(16)); });
+  };
+
+  "vector space operations"_ctest = [] {
+    constexpr auto p = G3::point{1, 2, 0, 0};
+    constexpr auto g = G3::plane{0, 3, 4, 0};
+    constexpr auto x = sparse{p};
+    constexpr auto y = sparse{g};
+
+    using V = decltype(p.multivector() + g.multivector());
+
+    return expect(
+        eq(p.multivector() + g.multivector(), static_cast<V>(x + y)) and
+        eq(p.multivector() - g.multivector(), static_cast<V>(x - y)) and
+        eq(8UZ, (x - y).size()) and
+        eq(sparse{G3::point{-1, -2, 0, 0}}, -x) and
+        eq(sparse{G3::point{2, 4, 0, 0}}, 2. * x) and ne(x, y));
+  };
+
+  "products match multivector products"_test = [] {
+    const auto p = G3::point{1, 2, 3, 4};
+    const auto q = G3::point{1, -1, 0, 2};
+    const auto g = G3::plane{1, 2, -2, 1};
+    const auto h = G3::plane{0, 1, 1, -3};
+    const auto m = G3::motor{1, 2, 3, 4, 5, 6, 7, 8};
+    const auto n = G3::motor{-1, 0, 2, 1, 3, -2, 1, 1};
+
+    return expect(
+        eq(wedge(p.multivector(), q.multivector()),
+           static_cast<G3::line::multivector_type>(
+               wedge(sparse{p}, sparse{q}))) and
+        eq(antiwedge(g.multivector(), h.multivector()),
+           static_cast<G3::line::multivector_type>(
+               antiwedge(sparse{g}, sparse{h}))) and
+        eq(geometric_product(p.multivector(), g.multivector()),
+           static_cast<decltype(geometric_product(
+               p.multivector(), g.multivector()))>(
+               geometric_product(sparse{p}, sparse{g}))) and
+        eq(geometric_antiproduct(m.multivector(), n.multivector()),
+           static_cast<G3::motor::multivector_type>(
+               geometric_antiproduct(sparse{m}, sparse{n}))));
+  };
+
+  "products only store blades with a term"_test = [] {
+    const auto p = sparse{G3::point{1, 0, 0, 0}};
+
+    return expect(
+        eq(0UZ, wedge(p, p).size()) and eq(0UZ, wedge(p, sparse{}).size()));
+  };
+
+  "algebras of different dimension"_test = [] {
+    const auto check = []<class A>(std::type_identity<A>) {
+      auto p = typename A::point::multivector_type{};
+      auto q = p;
+      p.template get<0>().coefficient = 1.;
+      p.template get<1>().coefficient = 2.;
+      q.template get<0>().coefficient = 1.;
+      q.template get<2>().coefficient = 3.;
+
+      using S = sparse_multivector<A>;
+      using V = decltype(wedge(p, q));
+      return static_cast<V>(wedge(S{p}, S{q})) == wedge(p, q);
+    };
+
+    return expect(
+        check(std::type_identity<G2>{}) and
+        check(std::type_identity<G3>{}) and
+        check(std::type_identity<G4>{}));
+  };
+}
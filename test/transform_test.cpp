@@ -0,0 +1,150 @@
+#include "rigid_geometric_algebra/rigid_geometric_algebra.hpp"
+#include "skytest/skytest.hpp"
+#include "support/soa_columns.hpp"
+
+#include "test/skytest_ext.hpp"
+
+#include <array>
+#include <numbers>
+#include <type_traits>
+#include <vector>
+
+using G3 = ::rigid_geometric_algebra::algebra<double, 3>;
+using bivector = G3::line::multivector_type;
+
+auto main() -> int
+{
+  using namespace skytest::literals;
+  using ::skytest::approx_equal;
+  using ::skytest::eq;
+  using ::skytest::expect;
+
+  using ::rigid_geometric_algebra::antiwedge;
+  using ::rigid_geometric_algebra::exp;
+  using ::rigid_geometric_algebra::soa_span;
+  using ::rigid_geometric_algebra::transform;
+  using ::rigid_geometric_algebra::wedge;
+  using ::support::columns;
+
+  // translation by `(1, 0, 0)`
+  static const auto shift = exp(bivector{0, 0, 0, -0.5, 0, 0});
+  // rotation by a quarter turn about z
+  static const auto turn = exp(bivector{0, 0, -std::numbers::pi / 4, 0, 0, 0});
+
+  "result has the type of the transformed element"_test = [] {
+    return expect(
+        std::is_same_v<G3::point, decltype(transform(shift, G3::point{}))> and
+        std::is_same_v<G3::plane, decltype(transform(shift, G3::plane{}))> and
+        std::is_same_v<
+            bivector,
+            decltype(transform(shift.multivector(), bivector{}))>);
+  };
+
+  "identity leaves a point unchanged"_test = [] {
+    return expect(
+        eq(G3::point{1, 2, 3, 4},
+           transform(G3::motor::identity(), G3::point{1, 2, 3, 4})));
+  };
+
+  "translated point"_test = [] {
+    return expect(approx_equal(
+        G3::point{1, 2, 2, 3}.multivector(),
+        transform(shift, G3::point{1, 1, 2, 3}).multivector()));
+  };
+
+  "rotated point"_test = [] {
+    return expect(approx_equal(
+        G3::point{1, 0, 1, 0}.multivector(),
+        transform(turn, G3::point{1, 1, 0, 0}).multivector()));
+  };
+
+  "translated plane"_test = [] {
+    return expect(approx_equal(
+        G3::plane{1, 0, 0, -3}.multivector(),
+        transform(shift, G3::plane{1, 0, 0, -2}).multivector()));
+  };
+
+  "transform commutes with wedge"_test = [] {
+    const auto p = G3::point{1, 1, 2, 3};
+    const auto q = G3::point{1, -1, 0, 2};
+
+    return expect(approx_equal(
+        transform(turn.multivector(), wedge(p.multivector(), q.multivector())),
+        wedge(
+            transform(turn, p).multivector(),
+            transform(turn, q).multivector())));
+  };
+
+  "batched transform by one motor"_test = [] {
+    auto in = std::array<std::vector<double>, G3::point::size>{
+        std::vector{1., 1.},
+        std::vector{1., 0.},
+        std::vector{2., 1.},
+        std::vector{3., 0.}};
+    auto out = columns<G3::point>(2);
+
+    const auto ps = soa_span<const G3::point>{in};
+    const auto qs = soa_span<G3::point>{out};
+
+    transform(shift, ps, qs);
+
+    return expect(
+        approx_equal(
+            transform(shift, ps[0]).multivector(), qs[0].multivector()) and
+        approx_equal(
+            transform(shift, ps[1]).multivector(), qs[1].multivector()));
+  };
+
+  "batched transform by many motors"_test = [] {
+    auto motors = columns<G3::motor>(2);
+    const auto ms = soa_span<G3::motor>{motors};
+    ms.store(0, shift);
+    ms.store(1, turn);
+
+    auto in = columns<G3::point>(2);
+    const auto ps = soa_span<G3::point>{in};
+    ps.store(0, G3::point{1, 1, 2, 3});
+    ps.store(1, G3::point{1, 1, 0, 0});
+
+    auto out = columns<G3::point>(2);
+    const auto qs = soa_span<G3::point>{out};
+
+    transform(soa_span<const G3::motor>{ms}, soa_span<const G3::point>{ps}, qs);
+
+    return expect(
+        approx_equal(
+            G3::point{1, 2, 2, 3}.multivector(), qs[0].multivector()) and
+        approx_equal(
+            G3::point{1, 0, 1, 0}.multivector(), qs[1].multivector()));
+  };
+
+  "batched wedge and antiwedge"_test = [] {
+    using point_mv = G3::point::multivector_type;
+    using plane_mv = G3::plane::multivector_type;
+
+    auto p_columns = columns<point_mv>(1);
+    auto q_columns = columns<point_mv>(1);
+    auto l_columns = columns<bivector>(1);
+    auto g_columns = columns<plane_mv>(1);
+    auto x_columns = columns<point_mv>(1);
+
+    const auto ps = soa_span<point_mv>{p_columns};
+    const auto qs = soa_span<point_mv>{q_columns};
+    const auto ls = soa_span<bivector>{l_columns};
+    const auto gs = soa_span<plane_mv>{g_columns};
+    const auto xs = soa_span<point_mv>{x_columns};
+
+    ps.store(0, point_mv{1, 0, 0, 0});
+    qs.store(0, point_mv{1, 0, 0, 1});
+    gs.store(0, plane_mv{0, 0, 1, -2});
+
+    wedge(soa_span<const point_mv>{ps}, soa_span<const point_mv>{qs}, ls);
+    antiwedge(soa_span<const bivector>{ls}, soa_span<const plane_mv>{gs}, xs);
+
+    // the z axis meets z = 2 at (0, 0, 2)
+    return expect(
+        eq(wedge(ps[0], qs[0]), ls[0]) and
+        eq(antiwedge(ls[0], gs[0]), xs[0]) and
+        eq(point_mv{1, 0, 0, 2}, xs[0]));
+  };
+}
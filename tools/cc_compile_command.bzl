@@ -0,0 +1,63 @@
+"""
+Helper to obtain the C++ compile command of a cc toolchain
+"""
+
+load("@rules_cc//cc:action_names.bzl", "ACTION_NAMES")
+
+visibility("//tools/...")
+
+def get_compile_command(
+        rule_ctx,
+        compilation_ctx,
+        toolchain,
+        extra_flags = None,
+        action_name = ACTION_NAMES.cpp_compile):
+    if action_name != ACTION_NAMES.cpp_compile:
+        fail("'{}' not currently supported".format(action_name))
+
+    fragment_flags = rule_ctx.fragments.cpp.cxxopts + rule_ctx.fragments.cpp.copts
+
+    feature_configuration = cc_common.configure_features(
+        ctx = rule_ctx,
+        cc_toolchain = toolchain,
+        requested_features = rule_ctx.features,
+        unsupported_features = rule_ctx.disabled_features,
+    )
+
+    compile_variables = cc_common.create_compile_variables(
+        cc_toolchain = toolchain,
+        feature_configuration = feature_configuration,
+        user_compile_flags = fragment_flags + (extra_flags or []),
+        include_directories = compilation_ctx.includes,
+        quote_include_directories = compilation_ctx.quote_includes,
+        system_include_directories = depset(
+            transitive = [
+                compilation_ctx.system_includes,
+                compilation_ctx.external_includes,
+            ],
+        ),
+        framework_include_directories = compilation_ctx.framework_includes,
+        preprocessor_defines = depset(
+            transitive = [
+                compilation_ctx.defines,
+                compilation_ctx.local_defines,
+            ],
+        ),
+    )
+
+    compiler = cc_common.get_tool_for_action(
+        feature_configuration = feature_configuration,
+        action_name = action_name,
+    )
+
+    options = cc_common.get_memory_inefficient_command_line(
+        feature_configuration = feature_configuration,
+        action_name = action_name,
+        variables = compile_variables,
+    )
+
+    return struct(
+        compiler = compiler,
+        options = options,
+        feature_configuration = feature_configuration,
+    )
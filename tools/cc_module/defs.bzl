@@ -0,0 +1,141 @@
+"""
+Rule to build a C++20 module interface unit with a Clang toolchain
+
+`rules_cc` does not support C++20 modules. `cc_module_interface` precompiles a
+module interface unit to a BMI (`<module_name>.pcm`) and compiles the BMI to an
+object file. The BMI is written to the package output directory and is
+propagated to dependents as a compile input, along with the module interface
+unit so that Clang can verify the BMI.
+
+Dependents import the module by adding the package output directory to the
+prebuilt module path:
+
+    cc_test(
+        name = "foo_test",
+        srcs = ["foo_test.cpp"],
+        copts = ["-fprebuilt-module-path=$(BINDIR)/path/to/package"],
+        deps = ["//path/to/package:module"],
+    )
+
+The BMI is built with the flags of the current cc toolchain and must be
+consumed with compatible flags.
+"""
+
+load("@rules_cc//cc:find_cc_toolchain.bzl", "CC_TOOLCHAIN_TYPE", "find_cc_toolchain")
+load("//tools:cc_compile_command.bzl", "get_compile_command")
+
+visibility("public")
+
+def _impl(ctx):
+    toolchain = find_cc_toolchain(ctx)
+
+    deps_cc_info = cc_common.merge_cc_infos(
+        cc_infos = [dep[CcInfo] for dep in ctx.attr.deps],
+    )
+    compilation_context = deps_cc_info.compilation_context
+
+    compile_command = get_compile_command(
+        ctx,
+        compilation_context,
+        toolchain,
+        ctx.attr.copts,
+    )
+
+    pcm = ctx.actions.declare_file(ctx.attr.module_name + ".pcm")
+    obj = ctx.actions.declare_file(
+        "_objs/{}/{}.o".format(ctx.label.name, ctx.attr.module_name),
+    )
+
+    ctx.actions.run(
+        inputs = depset(
+            direct = [ctx.file.src],
+            transitive = [compilation_context.headers],
+        ),
+        outputs = [pcm],
+        tools = toolchain.all_files,
+        executable = compile_command.compiler,
+        arguments = compile_command.options + [
+            "-x",
+            "c++-module",
+            "--precompile",
+            ctx.file.src.path,
+            "-o",
+            pcm.path,
+        ],
+        use_default_shell_env = True,
+        mnemonic = "CppModulePrecompile",
+        progress_message = "Precompiling module %{label}",
+    )
+
+    ctx.actions.run(
+        inputs = depset(
+            direct = [pcm, ctx.file.src],
+            transitive = [compilation_context.headers],
+        ),
+        outputs = [obj],
+        tools = toolchain.all_files,
+        executable = compile_command.compiler,
+        arguments = compile_command.options + [
+            "-fPIC",
+            "-c",
+            pcm.path,
+            "-o",
+            obj.path,
+        ],
+        use_default_shell_env = True,
+        mnemonic = "CppModuleCompile",
+        progress_message = "Compiling module %{label}",
+    )
+
+    linking_context, _ = cc_common.create_linking_context_from_compilation_outputs(
+        actions = ctx.actions,
+        name = ctx.label.name,
+        feature_configuration = compile_command.feature_configuration,
+        cc_toolchain = toolchain,
+        compilation_outputs = cc_common.create_compilation_outputs(
+            objects = depset([obj]),
+            pic_objects = depset([obj]),
+        ),
+        linking_contexts = [deps_cc_info.linking_context],
+        disallow_dynamic_library = True,
+    )
+
+    return [
+        DefaultInfo(files = depset([pcm, obj])),
+        CcInfo(
+            compilation_context = cc_common.merge_compilation_contexts(
+                compilation_contexts = [
+                    cc_common.create_compilation_context(
+                        headers = depset([pcm, ctx.file.src]),
+                    ),
+                    compilation_context,
+                ],
+            ),
+            linking_context = linking_context,
+        ),
+    ]
+
+cc_module_interface = rule(
+    implementation = _impl,
+    attrs = {
+        "src": attr.label(
+            doc = "module interface unit",
+            allow_single_file = [".cppm"],
+            mandatory = True,
+        ),
+        "module_name": attr.string(
+            doc = "name of the exported module",
+            mandatory = True,
+        ),
+        "copts": attr.string_list(
+            doc = "additional flags used to compile the module",
+        ),
+        "deps": attr.label_list(
+            doc = "libraries included by the module interface unit",
+            providers = [CcInfo],
+        ),
+    },
+    fragments = ["cpp"],
+    provides = [CcInfo],
+    toolchains = [CC_TOOLCHAIN_TYPE],
+)
@@ -2,8 +2,8 @@
 Aspect to generate a Clang time trace files for a C++ compilation
 """
 
-load("@rules_cc//cc:action_names.bzl", "ACTION_NAMES")
 load("@rules_cc//cc:find_cc_toolchain.bzl", "CC_TOOLCHAIN_TYPE", "find_cc_toolchain")
+load("//tools:cc_compile_command.bzl", "get_compile_command")
 
 visibility("//...")
 
@@ -14,71 +14,19 @@ def _format_label(label):
         label.name,
     )
 
-def _get_compile_command(
-        rule_ctx,
-        compilation_ctx,
-        toolchain,
-        extra_flags = None,
-        action_name = ACTION_NAMES.cpp_compile):
-    if action_name != ACTION_NAMES.cpp_compile:
-        fail("'{}' not currently supported".format(action_name))
-
-    fragment_flags = rule_ctx.fragments.cpp.cxxopts + rule_ctx.fragments.cpp.copts
-
-    feature_configuration = cc_common.configure_features(
-        ctx = rule_ctx,
-        cc_toolchain = toolchain,
-        requested_features = rule_ctx.features,
-        unsupported_features = rule_ctx.disabled_features,
-    )
-
-    compile_variables = cc_common.create_compile_variables(
-        cc_toolchain = toolchain,
-        feature_configuration = feature_configuration,
-        user_compile_flags = fragment_flags + (extra_flags or []),
-        include_directories = compilation_ctx.includes,
-        quote_include_directories = compilation_ctx.quote_includes,
-        system_include_directories = depset(
-            transitive = [
-                compilation_ctx.system_includes,
-                compilation_ctx.external_includes,
-            ],
-        ),
-        framework_include_directories = compilation_ctx.framework_includes,
-        preprocessor_defines = depset(
-            transitive = [
-                compilation_ctx.defines,
-                compilation_ctx.local_defines,
-            ],
-        ),
-    )
-
-    compiler = cc_common.get_tool_for_action(
-        feature_configuration = feature_configuration,
-        action_name = action_name,
-    )
-
-    options = cc_common.get_memory_inefficient_command_line(
-        feature_configuration = feature_configuration,
-        action_name = action_name,
-        variables = compile_variables,
-    )
-
-    return struct(
-        compiler = compiler,
-        options = options,
-    )
-
 def _impl(target, ctx):
     toolchain = find_cc_toolchain(ctx)
 
     compilation_context = target[CcInfo].compilation_context
 
-    compile_command = _get_compile_command(
+    compile_command = get_compile_command(
         ctx,
         compilation_context,
         toolchain,
-        getattr(ctx.rule.attr, "copts", []),
+        [
+            ctx.expand_make_variables("copts", copt, {})
+            for copt in getattr(ctx.rule.attr, "copts", [])
+        ],
     )
 
     outputs = []
@@ -0,0 +1,58 @@
+import json
+import sys
+from pathlib import Path
+
+# events recorded by `-ftime-trace` with the total time spent in each phase
+PHASES = [
+    "ExecuteCompiler",
+    "Frontend",
+    "Source",
+    "ParseClass",
+    "InstantiateClass",
+    "InstantiateFunction",
+    "PerformPendingInstantiations",
+    "Backend",
+]
+
+
+def trace_files(bazel_bin: Path, label: str) -> list[Path]:
+    """Time trace files written by the time trace aspect for `label`."""
+    package, sep, name = label.removeprefix("//").partition(":")
+    if not label.startswith("//") or not sep:
+        msg = f"expected a label of the form '//package:name', got '{label}'"
+        raise ValueError(msg)
+
+    files = sorted((bazel_bin / package / "_time_trace" / name).glob("*.json"))
+    if not files:
+        msg = f"no time trace files for '{label}' in '{bazel_bin}'"
+        raise FileNotFoundError(msg)
+    return files
+
+
+def totals(files: list[Path]) -> dict[str, float]:
+    """Total time in milliseconds of each phase, summed over `files`."""
+    result = dict.fromkeys(PHASES, 0.0)
+    for file in files:
+        for event in json.loads(file.read_text())["traceEvents"]:
+            name = event.get("name", "")
+            phase = name.removeprefix("Total ")
+            if phase != name and phase in result:
+                result[phase] += event["dur"] / 1000
+    return result
+
+
+def main(bazel_bin: Path, labels: list[str]) -> None:
+    """Print the time spent in each compiler phase for each target."""
+    columns = {label: totals(trace_files(bazel_bin, label)) for label in labels}
+    width = max(map(len, [*PHASES, *labels]))
+
+    print(" " * width, *(f"{label:>{width}}" for label in labels))
+    for phase in PHASES:
+        print(
+            f"{phase:<{width}}",
+            *(f"{columns[label][phase]:>{width - 3}.0f} ms" for label in labels),
+        )
+
+
+if __name__ == "__main__":
+    main(Path(sys.argv[1]), sys.argv[2:])